@@ -1,7 +1,7 @@
 project "App"
    kind "ConsoleApp"
    language "C++"
-   cppdialect "C++20"
+   cppdialect "C++23"
    targetdir "Binaries/%{cfg.buildcfg}"
    staticruntime "off"
 
@@ -28,6 +28,9 @@ project "App"
        systemversion "latest"
        defines { "WINDOWS" }
 
+   filter "system:linux"
+       links { "Glad", "pthread", "dl" }
+
    filter "configurations:Debug"
        defines { "DEBUG" }
        runtime "Debug"
@@ -1,7 +1,9 @@
 #include <Pulse.h>
+#include <charconv>
 #include <iostream>
 
 #include "PulseStudio/Events/KeyEvent.h"
+#include "PulseStudio/Events/MouseEvent.h"
 
 class ExampleLayer : public PulseStudio::Layer
 {
@@ -11,7 +13,7 @@ public:
 	{
 	}
 
-	void OnUpdate(float deltaTime) override
+	void OnUpdate(float) override
 	{
 		if (PulseStudio::Input::IsKeyPressed(PS_KEY_TAB))
 			PS_TRACE("Tab key is pressed (polling).");
@@ -22,27 +24,202 @@ public:
 		if (event.GetEventType() == PulseStudio::EventType::KeyPressed)
 		{
 			PulseStudio::KeyPressedEvent& e = (PulseStudio::KeyPressedEvent&)event;
-			PS_TRACE(std::format("{0}", (char)e.GetKeyCode()));
+			// Key codes name physical keys, only the printable range maps onto characters
+			int key = e.GetKeyCode();
+			if (key >= PS_KEY_SPACE && key <= PS_KEY_GRAVE_ACCENT)
+			{
+				std::string text;
+				PulseStudio::Utf8::Encode((uint32_t)key, text);
+				PS_TRACE("{0}", text);
+			}
+			else
+			{
+				PS_TRACE("Key {0}", key);
+			}
+			Invalidate();
 		}
 	}
 };
 
+// Fills a 200 column by 60 line viewport with text, the glyph atlas should stop rasterizing after
+// the first frame. Shows the first 60 lines of a file when given one. Ctrl+scroll zooms. Redraws
+// only after an edit or a zoom, run with --continuous to draw (and trace) every frame.
+class TextViewLayer : public PulseStudio::Layer
+{
+public:
+	TextViewLayer(std::shared_ptr<PulseStudio::Font> font, std::vector<std::string> lines = {})
+		: Layer("TextView"), m_Font(std::move(font)), m_Lines(std::move(lines))
+	{
+		if (m_Lines.empty())
+			GenerateLines();
+
+		// Rasterized on the workers, or read back from the glyph cache of an earlier run
+		m_Atlas.Preload(m_Font, m_PixelSize);
+	}
+
+	void OnUpdate(float) override
+	{
+		m_Atlas.BeginFrame();
+		m_Runs.BeginFrame();
+
+		PulseStudio::FontMetrics metrics = m_Font->GetMetrics(m_PixelSize);
+		glm::vec2 position = { 8.0f, 8.0f + metrics.Ascender };
+		uint32_t visibleLines = (uint32_t)std::min<size_t>(m_Lines.size(), s_Lines);
+		for (uint32_t line = 0; line < visibleLines; line++)
+		{
+			// Only lines edited since the last frame are laid out again
+			const PulseStudio::ShapedRun& run = m_Layout.GetLine(line, *m_Font, m_PixelSize, m_Lines[line]);
+			PulseStudio::TextRenderer::DrawRun(PulseStudio::Renderer2D::GetBatch(), m_Atlas, *m_Font, m_PixelSize,
+				position, run, { 0.1f, 0.1f, 0.1f, 1.0f });
+			position.y += metrics.LineHeight;
+		}
+	}
+
+	void OnEvent(PulseStudio::Event& event) override
+	{
+		if (event.GetEventType() == PulseStudio::EventType::KeyPressed)
+		{
+			OnKeyPressed((PulseStudio::KeyPressedEvent&)event);
+			return;
+		}
+
+		if (event.GetEventType() != PulseStudio::EventType::MouseScrolled || !PulseStudio::Input::IsKeyPressed(PS_KEY_LEFT_CONTROL))
+			return;
+
+		// Bitmap fonts rasterize every new size, distance field fonts only scale
+		float offset = ((PulseStudio::MouseScrolledEvent&)event).GetYOffset();
+		int size = (int)m_PixelSize + (offset > 0.0f ? 1 : offset < 0.0f ? -1 : 0);
+		m_PixelSize = (uint32_t)std::clamp(size, 8, 64);
+		event.m_Handled = true;
+		Invalidate();
+	}
+private:
+	void GenerateLines()
+	{
+		const char* source = "for (uint32_t i = 0; i < count; i++) { total += values[i] * weights[i]; } // ";
+		for (uint32_t line = 0; line < s_Lines; line++)
+		{
+			std::string text;
+			while (text.size() < s_Columns)
+				text += source + (line % 7);
+			text.resize(s_Columns);
+			m_Lines.push_back(std::move(text));
+		}
+	}
+
+	// Printable keys type into the first line, Enter splits it, Backspace joins the next line back
+	void OnKeyPressed(PulseStudio::KeyPressedEvent& event)
+	{
+		int key = event.GetKeyCode();
+		if (key == PS_KEY_ENTER)
+		{
+			// Split on a code point boundary
+			size_t split = m_Lines[0].size() / 2;
+			while (split > 0 && (m_Lines[0][split] & 0xC0) == 0x80)
+				split--;
+			m_Lines.insert(m_Lines.begin() + 1, m_Lines[0].substr(split));
+			m_Lines[0].resize(split);
+			m_Layout.InvalidateLine(0);
+			m_Layout.InsertLines(1, 1);
+		}
+		else if (key == PS_KEY_BACKSPACE && m_Lines.size() > 1)
+		{
+			m_Lines[0] += m_Lines[1];
+			m_Lines.erase(m_Lines.begin() + 1);
+			m_Layout.InvalidateLine(0);
+			m_Layout.EraseLines(1, 1);
+		}
+		else if (key >= PS_KEY_SPACE && key <= PS_KEY_Z)
+		{
+			std::string text;
+			PulseStudio::Utf8::Encode((uint32_t)key, text);
+			m_Lines[0].insert(0, text);
+			m_Layout.InvalidateLine(0);
+		}
+		else
+		{
+			return;
+		}
+		Invalidate();
+	}
+
+	static constexpr uint32_t s_Columns = 200;
+	static constexpr uint32_t s_Lines = 60;
+
+	uint32_t m_PixelSize = 14;
+
+	std::shared_ptr<PulseStudio::Font> m_Font;
+	PulseStudio::GlyphAtlas m_Atlas;
+	PulseStudio::ShapedRunCache m_Runs{ m_Atlas };
+	PulseStudio::TextLayout m_Layout{ m_Runs };
+	std::vector<std::string> m_Lines;
+};
+
 class SandboxApp : public PulseStudio::Application
 {
 public:
 	SandboxApp()
 	{
+		// Only repaint when a layer asks for it, an idle editor should not burn CPU
+		SetRenderMode(PulseStudio::RenderMode::OnDemand);
 	}
 	~SandboxApp()
 	{
 	}
 };
 
+// Reads a file into lines for the text view. Malformed UTF-8 is kept as is and draws as U+FFFD.
+static std::vector<std::string> LoadTextFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		PS_ERROR("Could not open {0}", path);
+		return {};
+	}
+	std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	size_t invalid = PulseStudio::Utf8::Validate(text);
+	if (invalid != text.size())
+		PS_WARN("{0} is not valid UTF-8 from byte {1} on", path, invalid);
+
+	std::vector<std::string> lines;
+	lines.reserve(PulseStudio::Utf8::CountNewlines(text) + 1);
+	size_t offset = 0;
+	while (true)
+	{
+		size_t end = PulseStudio::Utf8::FindNewline(text, offset);
+		size_t length = end - offset;
+		if (length > 0 && text[end - 1] == '\r')
+			length--;
+		lines.emplace_back(text, offset, length);
+		if (end == text.size())
+			break;
+		offset = end + 1;
+	}
+
+	PS_INFO("Opened {0}: {1} lines, {2} code points ({3} UTF-8 kernel)", path, lines.size(),
+		PulseStudio::Utf8::CountCodepoints(text), PulseStudio::Utf8::GetKernelName(PulseStudio::Utf8::GetKernel()));
+	return lines;
+}
+
+// Whole decimal number for a command line option, logs a usage error and returns false otherwise
+static bool ParseCount(const std::string& option, std::string_view value, uint32_t& count)
+{
+	auto [last, error] = std::from_chars(value.data(), value.data() + value.size(), count);
+	if (error == std::errc() && last == value.data() + value.size())
+		return true;
+
+	PS_ERROR("{0} expects a whole number, got '{1}', option ignored", option, value);
+	return false;
+}
+
 PulseStudio::Application* PulseStudio::CreateApplication()
 {
 	return new SandboxApp();
 }
 
+#ifdef _WIN32
 static void ChangeConsoelStatus(bool IsShow)
 {
 	HWND hwnd = GetConsoleWindow();
@@ -57,19 +234,101 @@ static void ChangeConsoelStatus(bool IsShow)
 		PS_INFO("Console is Hided.");
 	}
 }
+#endif
 
-int main()
+// Usage: App [--fps <60|120|144|uncapped>] [--record <file>] [--replay <file> [--fast]]
+//            [--trace <file>] [--profile-summary <frames>] [--memory-summary <frames>]
+//            [--font <file> [--sdf] [--open <file>]] [--continuous]
+int main(int argc, char** argv)
 {
+#if PS_TRACK_ALLOCATIONS
+	// Whatever the runtime allocated before main is not ours to report
+	PulseStudio::AllocationTracker::SetBaseline();
+#elif defined(_WIN32)
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
 
+#ifdef _WIN32
 	ChangeConsoelStatus(true);
+#endif
 
 	PulseStudio::Application* app = PulseStudio::CreateApplication();
 
 	std::cout.setf(std::ios::unitbuf);
 
+	std::string recordPath, replayPath, tracePath, fontPath, openPath;
+	bool replayFast = false;
+	PulseStudio::GlyphRenderMode fontMode = PulseStudio::GlyphRenderMode::Bitmap;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--record" && i + 1 < argc)
+			recordPath = argv[++i];
+		else if (arg == "--replay" && i + 1 < argc)
+			replayPath = argv[++i];
+		else if (arg == "--fast")
+			replayFast = true;
+		else if (arg == "--trace" && i + 1 < argc)
+			tracePath = argv[++i];
+		else if (arg == "--profile-summary" && i + 1 < argc)
+		{
+			uint32_t frames;
+			if (ParseCount(arg, argv[++i], frames))
+				PulseStudio::Profiler::SetSummaryInterval(frames);
+		}
+		else if (arg == "--memory-summary" && i + 1 < argc)
+		{
+			uint32_t frames;
+			if (ParseCount(arg, argv[++i], frames))
+				PulseStudio::Memory::SetSummaryInterval(frames);
+		}
+		else if (arg == "--font" && i + 1 < argc)
+			fontPath = argv[++i];
+		else if (arg == "--open" && i + 1 < argc)
+			openPath = argv[++i];
+		else if (arg == "--sdf")
+			fontMode = PulseStudio::GlyphRenderMode::DistanceField;
+		else if (arg == "--continuous")
+			app->SetRenderMode(PulseStudio::RenderMode::Continuous);
+		else if (arg == "--fps" && i + 1 < argc)
+		{
+			std::string rate = argv[++i];
+			uint32_t framesPerSecond = 0;
+			if (rate == "uncapped" || ParseCount(arg, rate, framesPerSecond))
+				app->SetTargetFrameRate(framesPerSecond);
+		}
+	}
+
+	if (!fontPath.empty())
+	{
+		if (std::shared_ptr<PulseStudio::Font> font = PulseStudio::Font::Load(fontPath))
+		{
+			font->SetRenderMode(fontMode);
+			app->PushLayer(new TextViewLayer(font, openPath.empty() ? std::vector<std::string>() : LoadTextFile(openPath)));
+		}
+	}
+
+	if (!replayPath.empty())
+	{
+		// Benchmark run: feed the recording through the layers and exit
+		app->ReplayEvents(replayPath, replayFast ? PulseStudio::ReplayTiming::AsFastAsPossible : PulseStudio::ReplayTiming::Original);
+		delete app;
+		PulseStudio::AllocationTracker::ReportLeaks();
+		return 0;
+	}
+
+	if (!recordPath.empty())
+		app->StartEventRecording(recordPath);
+
 	app->Run();
 
+	// Last frames from every thread, open in chrome://tracing or Perfetto
+	if (!tracePath.empty())
+		PulseStudio::Profiler::WriteChromeTrace(tracePath);
+
 	delete app;
+
+	// Live and peak heap per subsystem, anything the session left behind shows up as leaked
+	PulseStudio::AllocationTracker::ReportLeaks();
 	return 0;
 }
@@ -0,0 +1,85 @@
+#include "Benchmark.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace Benchmark {
+
+	struct Entry
+	{
+		const char* Name;
+		Function Run;
+	};
+
+	// Function-local so registration from other translation units never sees it uninitialized
+	static std::vector<Entry>& GetRegistry()
+	{
+		static std::vector<Entry> s_Registry;
+		return s_Registry;
+	}
+
+	bool Register(const char* name, Function function)
+	{
+		GetRegistry().push_back({ name, function });
+		return true;
+	}
+
+	void Report(const char* label, uint64_t items, std::chrono::nanoseconds elapsed)
+	{
+		double perItem = (double)elapsed.count() / (double)std::max<uint64_t>(items, 1);
+		std::printf("  %-44s %12.2f ns/item  %10.2f ms  (%llu items)\n", label, perItem,
+			(double)elapsed.count() / 1e6, (unsigned long long)items);
+	}
+
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Context context;
+	bool list = false;
+	std::vector<std::string_view> filters;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg = argv[i];
+		if (arg == "--quick")
+			context.Quick = true;
+		else if (arg == "--list")
+			list = true;
+		else
+			filters.push_back(arg);
+	}
+
+	auto& registry = Benchmark::GetRegistry();
+	std::sort(registry.begin(), registry.end(), [](const auto& a, const auto& b) { return std::strcmp(a.Name, b.Name) < 0; });
+
+	int ran = 0;
+	for (const auto& entry : registry)
+	{
+		std::string_view name = entry.Name;
+		bool selected = filters.empty() || std::any_of(filters.begin(), filters.end(),
+			[&](std::string_view filter) { return name.find(filter) != std::string_view::npos; });
+		if (!selected)
+			continue;
+
+		if (list)
+		{
+			std::printf("%s\n", entry.Name);
+			continue;
+		}
+
+		std::printf("%s\n", entry.Name);
+		std::fflush(stdout);
+		entry.Run(context);
+		ran++;
+	}
+
+	if (!list && ran == 0)
+	{
+		std::fprintf(stderr, "No benchmark matches the filter\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+// Minimal benchmark harness. A benchmark registers itself with PS_BENCHMARK and reports each
+// measured section through Benchmark::Measure(), the runner prints one line per section.
+//
+// Usage: Benchmarks [--quick] [--list] [name filter...]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Benchmark {
+
+	struct Context
+	{
+		// --quick divides the work by 100, enough to check that every benchmark still runs
+		bool Quick = false;
+
+		uint64_t Scale(uint64_t count) const { return Quick ? std::max<uint64_t>(count / 100, 1) : count; }
+	};
+
+	using Function = void(*)(Context&);
+
+	bool Register(const char* name, Function function);
+
+	// Prints "label  ns/item" for a measured section
+	void Report(const char* label, uint64_t items, std::chrono::nanoseconds elapsed);
+
+	// Runs body once and reports the time per item, returns nanoseconds per item
+	template<typename Body>
+	double Measure(const char* label, uint64_t items, Body&& body)
+	{
+		auto start = std::chrono::steady_clock::now();
+		body();
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+		Report(label, items, elapsed);
+		return (double)elapsed.count() / (double)std::max<uint64_t>(items, 1);
+	}
+
+	// Keeps the optimizer from dropping a result that is never used
+	template<typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#ifdef _MSC_VER
+		static const void* volatile s_Sink;
+		s_Sink = &value;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r"(&value) : "memory");
+#endif
+	}
+
+}
+
+#define PS_BENCHMARK(name) \
+	static void name(Benchmark::Context& context); \
+	static const bool s_##name##Registered = Benchmark::Register(#name, name); \
+	static void name(Benchmark::Context& context)
@@ -0,0 +1,80 @@
+// Cost of a zoom sweep over the ASCII and Latin-1 glyphs: bitmap fonts rasterize every glyph again
+// at each pixel size, distance field fonts generate every glyph once at Font::DistanceFieldSize.
+// CPU side only, atlas space is the sum of the glyph bitmaps without packing overhead.
+//
+// Needs a font file: PS_BENCHMARK_FONT=<file.ttf>
+
+#include "Benchmark.h"
+
+#include "PulseStudio/Text/Font.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace PulseStudio;
+
+// The range GlyphAtlas::Preload() caches
+static std::vector<uint32_t> GetPreloadGlyphs(const Font& font)
+{
+	std::vector<uint32_t> glyphs;
+	for (uint32_t codepoint = 0x20; codepoint <= 0xFF; codepoint++)
+	{
+		if (codepoint >= 0x7F && codepoint < 0xA0)
+			continue;
+		if (uint32_t glyph = font.GetGlyphIndex(codepoint))
+			glyphs.push_back(glyph);
+	}
+	return glyphs;
+}
+
+PS_BENCHMARK(GlyphZoomSweep)
+{
+	const char* path = std::getenv("PS_BENCHMARK_FONT");
+	if (!path)
+	{
+		std::printf("  skipped, set PS_BENCHMARK_FONT to a font file\n");
+		return;
+	}
+
+	std::shared_ptr<Font> font = Font::Load(path);
+	if (!font)
+	{
+		std::printf("  skipped, cannot load %s\n", path);
+		return;
+	}
+
+	std::vector<uint32_t> glyphs = GetPreloadGlyphs(*font);
+
+	// The TextView zoom range in whole pixels, --quick samples every 8th size
+	const uint32_t minSize = 8, maxSize = 64, step = context.Quick ? 8 : 1;
+	uint64_t sizes = (maxSize - minSize) / step + 1;
+
+	GlyphBitmap bitmap;
+	uint64_t bitmapBytes = 0;
+	Benchmark::Measure("Bitmap, rasterize per size (per glyph)", sizes * glyphs.size(), [&]()
+	{
+		for (uint32_t size = minSize; size <= maxSize; size += step)
+		{
+			for (uint32_t glyph : glyphs)
+			{
+				if (font->RasterizeGlyph(glyph, size, bitmap))
+					bitmapBytes += (uint64_t)bitmap.Width * bitmap.Height;
+			}
+		}
+	});
+
+	uint64_t fieldBytes = 0;
+	Benchmark::Measure("Distance field, generate once (per glyph)", glyphs.size(), [&]()
+	{
+		for (uint32_t glyph : glyphs)
+		{
+			if (font->GenerateDistanceField(glyph, bitmap))
+				fieldBytes += (uint64_t)bitmap.Width * bitmap.Height;
+		}
+	});
+
+	std::printf("  %llu glyphs, %llu sizes, atlas space: bitmap %.1f KB, distance field %.1f KB\n",
+		(unsigned long long)glyphs.size(), (unsigned long long)sizes, bitmapBytes / 1024.0, fieldBytes / 1024.0);
+}
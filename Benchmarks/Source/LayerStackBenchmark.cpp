@@ -0,0 +1,129 @@
+// Event delivery through a 20-layer stack: the polymorphic walk over every layer, EventValues
+// through the LayerStack dispatch lists, and the full EventBus enqueue + per-frame dispatch path
+
+#include "Benchmark.h"
+
+#include "PulseStudio/LayerStack.h"
+#include "PulseStudio/Events/EventBus.h"
+#include "PulseStudio/Events/EventValue.h"
+
+#include <memory>
+#include <vector>
+
+using namespace PulseStudio;
+
+class CountingLayer : public Layer
+{
+public:
+	CountingLayer(int categories)
+		: Layer("Counting")
+	{
+		SetEventCategories(categories);
+	}
+
+	// Filters on its own like a layer written before dispatch lists, never handles the event
+	void OnEvent(Event& event) override
+	{
+		if (!event.IsInCategory((EventCategory)m_EventCategoryMask))
+			return;
+
+		EventDispatcher dispatcher(event);
+		dispatcher.Dispatch<KeyPressedEvent>([this](KeyPressedEvent& e) { Sum += e.GetKeyCode(); return false; });
+		dispatcher.Dispatch<MouseButtonPressedEvent>([this](MouseButtonPressedEvent& e) { Sum += e.GetMouseButton(); return false; });
+		dispatcher.Dispatch<MouseMovedEvent>([this](MouseMovedEvent& e) { Sum += (uint64_t)e.GetX(); return false; });
+		dispatcher.Dispatch<MouseScrolledEvent>([this](MouseScrolledEvent& e) { Sum += (uint64_t)e.GetYOffset(); return false; });
+	}
+
+	uint64_t Sum = 0;
+};
+
+static constexpr size_t LayerCount = 20;
+static constexpr size_t EventPoolSize = 1024;
+static constexpr size_t EventsPerFrame = 1000;
+
+// Keyboard and mouse layers alternate, so each event reaches half of the stack
+static void PushLayers(LayerStack& stack)
+{
+	for (size_t i = 0; i < LayerCount; i++)
+		stack.PushLayer(new CountingLayer(i % 2 == 0 ? EventCategoryKeyboard : EventCategoryMouse | EventCategoryMouseButton));
+}
+
+static EventValue MakeEvent(size_t index)
+{
+	switch (index % 4)
+	{
+	case 0:  return KeyPressedEvent((int)(index % 97), 0);
+	case 1:  return MouseMovedEvent((float)(index % 640), (float)(index % 480));
+	case 2:  return MouseButtonPressedEvent((int)(index % 3));
+	default: return MouseScrolledEvent(0.0f, 1.0f);
+	}
+}
+
+static uint64_t SumLayers(LayerStack& stack)
+{
+	uint64_t sum = 0;
+	for (Layer* layer : stack)
+		sum += static_cast<CountingLayer*>(layer)->Sum;
+	return sum;
+}
+
+PS_BENCHMARK(LayerStackDispatch)
+{
+	const uint64_t count = context.Scale(10'000'000);
+
+	LayerStack stack;
+	PushLayers(stack);
+
+	std::vector<EventValue> values;
+	std::vector<std::unique_ptr<Event>> events;
+	for (size_t i = 0; i < EventPoolSize; i++)
+	{
+		values.push_back(MakeEvent(i));
+		events.push_back(values.back().Visit([](const auto& e) -> std::unique_ptr<Event> { return std::make_unique<std::decay_t<decltype(e)>>(e); }));
+	}
+
+	Benchmark::Measure("Event& through every layer", count, [&]()
+	{
+		for (uint64_t i = 0; i < count; i++)
+		{
+			Event& e = *events[i % EventPoolSize];
+			for (auto it = stack.end(); it != stack.begin();)
+			{
+				(*--it)->OnEvent(e);
+				if (e.m_Handled)
+					break;
+			}
+		}
+	});
+
+	auto deliver = [&](EventValue& value)
+	{
+		Event& e = value.AsEvent();
+		for (Layer* layer : stack.GetDispatchList(value.GetEventType()))
+		{
+			layer->OnEvent(e);
+			if (e.m_Handled)
+				break;
+		}
+	};
+
+	Benchmark::Measure("EventValue through dispatch lists", count, [&]()
+	{
+		for (uint64_t i = 0; i < count; i++)
+			deliver(values[i % EventPoolSize]);
+	});
+
+	// Frames of queued events, the way platform callbacks feed Application::Run
+	EventBus bus;
+	Benchmark::Measure("EventBus enqueue + dispatch", count, [&]()
+	{
+		for (uint64_t i = 0; i < count; i += EventsPerFrame)
+		{
+			for (uint64_t j = i; j < std::min<uint64_t>(i + EventsPerFrame, count); j++)
+				bus.Enqueue(values[j % EventPoolSize]);
+			bus.Dispatch(deliver);
+		}
+	});
+
+	Benchmark::DoNotOptimize(SumLayers(stack));
+}
@@ -0,0 +1,54 @@
+// Timestamp cost on the logger hot path: the per-line system_clock/localtime/put_time path the
+// logger used before LogClock, against LogClock's calibrated steady_clock read and cached prefix
+
+#include "Benchmark.h"
+
+#include "PulseStudio/LogClock.h"
+
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+// The old Logger::getTimestamp()
+static std::string FormatTimestampUncached(std::chrono::system_clock::time_point now)
+{
+	auto time = std::chrono::system_clock::to_time_t(now);
+	auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
+
+	std::stringstream ss;
+	ss << std::put_time(std::localtime(&time), "%Y/%m/%d %H:%M:%S")
+		<< '.' << std::setfill('0') << std::setw(3) << ms.count();
+	return ss.str();
+}
+
+PS_BENCHMARK(LogClockTimestamp)
+{
+	const uint64_t count = context.Scale(2'000'000);
+	LogClock::calibrate();
+
+	Benchmark::Measure("system_clock + localtime + put_time", count, [&]()
+	{
+		for (uint64_t i = 0; i < count; i++)
+			Benchmark::DoNotOptimize(FormatTimestampUncached(std::chrono::system_clock::now()));
+	});
+
+	// The logger appends into the line it is building, reuse one buffer the same way
+	std::string line;
+	line.reserve(64);
+	Benchmark::Measure("LogClock::now + appendTimestamp", count, [&]()
+	{
+		for (uint64_t i = 0; i < count; i++)
+		{
+			line.clear();
+			LogClock::appendTimestamp(LogClock::now(), line);
+			Benchmark::DoNotOptimize(line);
+		}
+	});
+
+	Benchmark::Measure("LogClock::now", count, [&]()
+	{
+		for (uint64_t i = 0; i < count; i++)
+			Benchmark::DoNotOptimize(LogClock::now());
+	});
+}
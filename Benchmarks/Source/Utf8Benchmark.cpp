@@ -0,0 +1,105 @@
+// Utf8 bulk operations with every kernel the CPU supports, on ASCII log lines, CJK text and ASCII
+// with a stray byte every 97 bytes. Items are input bytes.
+
+#include "Benchmark.h"
+
+#include "PulseStudio/Text/Utf8.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace PulseStudio;
+
+static std::string MakeAsciiText(size_t size)
+{
+	const char* line = "2026/10/17 09:51:44.123 [Info] Frame 1024 took 6.94 ms, 3 glyphs rasterized\n";
+	std::string text;
+	text.reserve(size + 128);
+	while (text.size() < size)
+		text += line;
+	text.resize(size);
+	return text;
+}
+
+// Ideographs with full-width punctuation, a comma every 8 code points and a full stop and line
+// break every 40
+static std::string MakeCjkText(size_t size)
+{
+	std::string text;
+	text.reserve(size + 8);
+	uint32_t codepoint = 0x4E00;
+	for (uint32_t i = 0; text.size() < size; i++)
+	{
+		if (i % 40 == 39)
+		{
+			Utf8::Encode(0x3002, text);
+			text += '\n';
+		}
+		else if (i % 8 == 7)
+			Utf8::Encode(0xFF0C, text);
+		else
+			Utf8::Encode(codepoint, text);
+
+		if (++codepoint > 0x9FFF)
+			codepoint = 0x4E00;
+	}
+	text.resize(size);
+	return text;
+}
+
+static std::string MakeInvalidText(size_t size)
+{
+	std::string text = MakeAsciiText(size);
+	for (size_t i = 96; i < text.size(); i += 97)
+		text[i] = (char)0xFF;
+	return text;
+}
+
+static void MeasureKernels(const char* name, const std::string& text)
+{
+	std::vector<uint32_t> output(text.size());
+	Utf8::Kernel original = Utf8::GetKernel();
+
+	for (Utf8::Kernel kernel : { Utf8::Kernel::Scalar, Utf8::Kernel::SSE41, Utf8::Kernel::AVX2 })
+	{
+		Utf8::SetKernel(kernel);
+		std::string prefix = std::string(name) + ", " + Utf8::GetKernelName(kernel);
+		if (Utf8::GetKernel() != kernel)
+		{
+			std::printf("  %-44s skipped, not supported by this CPU\n", prefix.c_str());
+			continue;
+		}
+
+		// Resumes after every error, as a loader reporting all of them would
+		Benchmark::Measure((prefix + ", Validate").c_str(), text.size(), [&]()
+		{
+			for (size_t offset = 0; offset < text.size(); )
+				offset += Utf8::Validate(std::string_view(text).substr(offset)) + 1;
+		});
+		Benchmark::Measure((prefix + ", CountCodepoints").c_str(), text.size(), [&]()
+		{
+			Benchmark::DoNotOptimize(Utf8::CountCodepoints(text));
+		});
+		Benchmark::Measure((prefix + ", Decode").c_str(), text.size(), [&]()
+		{
+			Benchmark::DoNotOptimize(Utf8::Decode(text, output));
+			Benchmark::DoNotOptimize(output);
+		});
+		Benchmark::Measure((prefix + ", CountNewlines").c_str(), text.size(), [&]()
+		{
+			Benchmark::DoNotOptimize(Utf8::CountNewlines(text));
+		});
+	}
+
+	Utf8::SetKernel(original);
+}
+
+PS_BENCHMARK(Utf8Kernels)
+{
+	const size_t size = context.Scale(64 * 1024 * 1024);
+
+	MeasureKernels("ASCII", MakeAsciiText(size));
+	MeasureKernels("CJK", MakeCjkText(size));
+	MeasureKernels("Invalid", MakeInvalidText(size));
+}
@@ -7,6 +7,17 @@ workspace "Pulse Studio IDE"
    filter "system:windows"
       buildoptions { "/EHsc", "/Zc:preprocessor", "/Zc:__cplusplus" }
 
+newoption
+{
+   trigger = "track-allocations",
+   description = "Route global new/delete through the allocation tracker for heap and leak reports"
+}
+
+-- Applies to every project so App and Core agree on the allocation header
+filter "options:track-allocations"
+   defines { "PS_TRACK_ALLOCATIONS=1" }
+filter {}
+
 OutputDir = "%{cfg.system}-%{cfg.architecture}/%{cfg.buildcfg}"
 
 group "Core"
@@ -14,6 +25,19 @@ group "Core"
 group ""
 
 include "App/Build-App.lua"
+
+group "Tools"
+	include "Tools/LogDecode/Build-LogDecode.lua"
+group ""
+
+group "Benchmarks"
+	include "Benchmarks/Build-Benchmarks.lua"
+group ""
+
+group "Tests"
+	include "Tests/Build-Tests.lua"
+group ""
+
 include "Core/vendor/GLFW"
 include "Core/vendor/Glad"
 include "Core/vendor/glm"
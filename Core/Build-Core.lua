@@ -22,7 +22,6 @@ project "Core"
     
     defines
     {
-        "PS_PLATFORM_WINDOWS",
         "PS_ENABLE_ASSERTS",
         "GLFW_INCLUDE_NONE"
     }
@@ -32,9 +31,8 @@ project "Core"
          "GLFW",
          "Glad",
          "GLM",
-        --  "Freetype",
-         "Image",
-         "opengl32.lib"
+         "Freetype",
+         "Image"
     }
     
     targetdir ("../Binaries/" .. OutputDir .. "/%{prj.name}")
@@ -43,7 +41,15 @@ project "Core"
     filter "system:windows"
         systemversion "latest"
         buildoptions { "/utf-8" }
-        defines { }
+        defines { "PS_PLATFORM_WINDOWS" }
+        links { "opengl32.lib", "winmm.lib" }
+    
+    -- Linux build machines run the headless window backend, no display or GL driver needed
+    filter "system:linux"
+        pic "On"
+        defines { "PS_PLATFORM_LINUX" }
+        removefiles { "Source/Platform/Windows/**" }
+        links { "pthread", "dl" }
     
     filter "configurations:Debug"
         defines { "DEBUG" }
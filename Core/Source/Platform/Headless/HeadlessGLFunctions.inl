@@ -0,0 +1,1095 @@
+// Generated by Scripts/Generate-HeadlessGL.sh from Core/vendor/Glad/include/glad/glad.h, do not edit
+// PS_HEADLESS_GL_FUNCTION(name, pointer type)
+PS_HEADLESS_GL_FUNCTION(glCullFace, PFNGLCULLFACEPROC)
+PS_HEADLESS_GL_FUNCTION(glFrontFace, PFNGLFRONTFACEPROC)
+PS_HEADLESS_GL_FUNCTION(glHint, PFNGLHINTPROC)
+PS_HEADLESS_GL_FUNCTION(glLineWidth, PFNGLLINEWIDTHPROC)
+PS_HEADLESS_GL_FUNCTION(glPointSize, PFNGLPOINTSIZEPROC)
+PS_HEADLESS_GL_FUNCTION(glPolygonMode, PFNGLPOLYGONMODEPROC)
+PS_HEADLESS_GL_FUNCTION(glScissor, PFNGLSCISSORPROC)
+PS_HEADLESS_GL_FUNCTION(glTexParameterf, PFNGLTEXPARAMETERFPROC)
+PS_HEADLESS_GL_FUNCTION(glTexParameterfv, PFNGLTEXPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexParameteri, PFNGLTEXPARAMETERIPROC)
+PS_HEADLESS_GL_FUNCTION(glTexParameteriv, PFNGLTEXPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexImage1D, PFNGLTEXIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexImage2D, PFNGLTEXIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawBuffer, PFNGLDRAWBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glClear, PFNGLCLEARPROC)
+PS_HEADLESS_GL_FUNCTION(glClearColor, PFNGLCLEARCOLORPROC)
+PS_HEADLESS_GL_FUNCTION(glClearStencil, PFNGLCLEARSTENCILPROC)
+PS_HEADLESS_GL_FUNCTION(glClearDepth, PFNGLCLEARDEPTHPROC)
+PS_HEADLESS_GL_FUNCTION(glStencilMask, PFNGLSTENCILMASKPROC)
+PS_HEADLESS_GL_FUNCTION(glColorMask, PFNGLCOLORMASKPROC)
+PS_HEADLESS_GL_FUNCTION(glDepthMask, PFNGLDEPTHMASKPROC)
+PS_HEADLESS_GL_FUNCTION(glDisable, PFNGLDISABLEPROC)
+PS_HEADLESS_GL_FUNCTION(glEnable, PFNGLENABLEPROC)
+PS_HEADLESS_GL_FUNCTION(glFinish, PFNGLFINISHPROC)
+PS_HEADLESS_GL_FUNCTION(glFlush, PFNGLFLUSHPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendFunc, PFNGLBLENDFUNCPROC)
+PS_HEADLESS_GL_FUNCTION(glLogicOp, PFNGLLOGICOPPROC)
+PS_HEADLESS_GL_FUNCTION(glStencilFunc, PFNGLSTENCILFUNCPROC)
+PS_HEADLESS_GL_FUNCTION(glStencilOp, PFNGLSTENCILOPPROC)
+PS_HEADLESS_GL_FUNCTION(glDepthFunc, PFNGLDEPTHFUNCPROC)
+PS_HEADLESS_GL_FUNCTION(glPixelStoref, PFNGLPIXELSTOREFPROC)
+PS_HEADLESS_GL_FUNCTION(glPixelStorei, PFNGLPIXELSTOREIPROC)
+PS_HEADLESS_GL_FUNCTION(glReadBuffer, PFNGLREADBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glReadPixels, PFNGLREADPIXELSPROC)
+PS_HEADLESS_GL_FUNCTION(glGetBooleanv, PFNGLGETBOOLEANVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetDoublev, PFNGLGETDOUBLEVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetError, PFNGLGETERRORPROC)
+PS_HEADLESS_GL_FUNCTION(glGetFloatv, PFNGLGETFLOATVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetIntegerv, PFNGLGETINTEGERVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetString, PFNGLGETSTRINGPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexImage, PFNGLGETTEXIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glIsEnabled, PFNGLISENABLEDPROC)
+PS_HEADLESS_GL_FUNCTION(glDepthRange, PFNGLDEPTHRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glViewport, PFNGLVIEWPORTPROC)
+PS_HEADLESS_GL_FUNCTION(glNewList, PFNGLNEWLISTPROC)
+PS_HEADLESS_GL_FUNCTION(glEndList, PFNGLENDLISTPROC)
+PS_HEADLESS_GL_FUNCTION(glCallList, PFNGLCALLLISTPROC)
+PS_HEADLESS_GL_FUNCTION(glCallLists, PFNGLCALLLISTSPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteLists, PFNGLDELETELISTSPROC)
+PS_HEADLESS_GL_FUNCTION(glGenLists, PFNGLGENLISTSPROC)
+PS_HEADLESS_GL_FUNCTION(glListBase, PFNGLLISTBASEPROC)
+PS_HEADLESS_GL_FUNCTION(glBegin, PFNGLBEGINPROC)
+PS_HEADLESS_GL_FUNCTION(glBitmap, PFNGLBITMAPPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3b, PFNGLCOLOR3BPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3bv, PFNGLCOLOR3BVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3d, PFNGLCOLOR3DPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3dv, PFNGLCOLOR3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3f, PFNGLCOLOR3FPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3fv, PFNGLCOLOR3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3i, PFNGLCOLOR3IPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3iv, PFNGLCOLOR3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3s, PFNGLCOLOR3SPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3sv, PFNGLCOLOR3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3ub, PFNGLCOLOR3UBPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3ubv, PFNGLCOLOR3UBVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3ui, PFNGLCOLOR3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3uiv, PFNGLCOLOR3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3us, PFNGLCOLOR3USPROC)
+PS_HEADLESS_GL_FUNCTION(glColor3usv, PFNGLCOLOR3USVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4b, PFNGLCOLOR4BPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4bv, PFNGLCOLOR4BVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4d, PFNGLCOLOR4DPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4dv, PFNGLCOLOR4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4f, PFNGLCOLOR4FPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4fv, PFNGLCOLOR4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4i, PFNGLCOLOR4IPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4iv, PFNGLCOLOR4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4s, PFNGLCOLOR4SPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4sv, PFNGLCOLOR4SVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4ub, PFNGLCOLOR4UBPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4ubv, PFNGLCOLOR4UBVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4ui, PFNGLCOLOR4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4uiv, PFNGLCOLOR4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4us, PFNGLCOLOR4USPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4usv, PFNGLCOLOR4USVPROC)
+PS_HEADLESS_GL_FUNCTION(glEdgeFlag, PFNGLEDGEFLAGPROC)
+PS_HEADLESS_GL_FUNCTION(glEdgeFlagv, PFNGLEDGEFLAGVPROC)
+PS_HEADLESS_GL_FUNCTION(glEnd, PFNGLENDPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexd, PFNGLINDEXDPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexdv, PFNGLINDEXDVPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexf, PFNGLINDEXFPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexfv, PFNGLINDEXFVPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexi, PFNGLINDEXIPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexiv, PFNGLINDEXIVPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexs, PFNGLINDEXSPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexsv, PFNGLINDEXSVPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3b, PFNGLNORMAL3BPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3bv, PFNGLNORMAL3BVPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3d, PFNGLNORMAL3DPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3dv, PFNGLNORMAL3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3f, PFNGLNORMAL3FPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3fv, PFNGLNORMAL3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3i, PFNGLNORMAL3IPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3iv, PFNGLNORMAL3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3s, PFNGLNORMAL3SPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3sv, PFNGLNORMAL3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos2d, PFNGLRASTERPOS2DPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos2dv, PFNGLRASTERPOS2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos2f, PFNGLRASTERPOS2FPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos2fv, PFNGLRASTERPOS2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos2i, PFNGLRASTERPOS2IPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos2iv, PFNGLRASTERPOS2IVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos2s, PFNGLRASTERPOS2SPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos2sv, PFNGLRASTERPOS2SVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos3d, PFNGLRASTERPOS3DPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos3dv, PFNGLRASTERPOS3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos3f, PFNGLRASTERPOS3FPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos3fv, PFNGLRASTERPOS3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos3i, PFNGLRASTERPOS3IPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos3iv, PFNGLRASTERPOS3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos3s, PFNGLRASTERPOS3SPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos3sv, PFNGLRASTERPOS3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos4d, PFNGLRASTERPOS4DPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos4dv, PFNGLRASTERPOS4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos4f, PFNGLRASTERPOS4FPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos4fv, PFNGLRASTERPOS4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos4i, PFNGLRASTERPOS4IPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos4iv, PFNGLRASTERPOS4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos4s, PFNGLRASTERPOS4SPROC)
+PS_HEADLESS_GL_FUNCTION(glRasterPos4sv, PFNGLRASTERPOS4SVPROC)
+PS_HEADLESS_GL_FUNCTION(glRectd, PFNGLRECTDPROC)
+PS_HEADLESS_GL_FUNCTION(glRectdv, PFNGLRECTDVPROC)
+PS_HEADLESS_GL_FUNCTION(glRectf, PFNGLRECTFPROC)
+PS_HEADLESS_GL_FUNCTION(glRectfv, PFNGLRECTFVPROC)
+PS_HEADLESS_GL_FUNCTION(glRecti, PFNGLRECTIPROC)
+PS_HEADLESS_GL_FUNCTION(glRectiv, PFNGLRECTIVPROC)
+PS_HEADLESS_GL_FUNCTION(glRects, PFNGLRECTSPROC)
+PS_HEADLESS_GL_FUNCTION(glRectsv, PFNGLRECTSVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord1d, PFNGLTEXCOORD1DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord1dv, PFNGLTEXCOORD1DVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord1f, PFNGLTEXCOORD1FPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord1fv, PFNGLTEXCOORD1FVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord1i, PFNGLTEXCOORD1IPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord1iv, PFNGLTEXCOORD1IVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord1s, PFNGLTEXCOORD1SPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord1sv, PFNGLTEXCOORD1SVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord2d, PFNGLTEXCOORD2DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord2dv, PFNGLTEXCOORD2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord2f, PFNGLTEXCOORD2FPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord2fv, PFNGLTEXCOORD2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord2i, PFNGLTEXCOORD2IPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord2iv, PFNGLTEXCOORD2IVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord2s, PFNGLTEXCOORD2SPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord2sv, PFNGLTEXCOORD2SVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord3d, PFNGLTEXCOORD3DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord3dv, PFNGLTEXCOORD3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord3f, PFNGLTEXCOORD3FPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord3fv, PFNGLTEXCOORD3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord3i, PFNGLTEXCOORD3IPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord3iv, PFNGLTEXCOORD3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord3s, PFNGLTEXCOORD3SPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord3sv, PFNGLTEXCOORD3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord4d, PFNGLTEXCOORD4DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord4dv, PFNGLTEXCOORD4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord4f, PFNGLTEXCOORD4FPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord4fv, PFNGLTEXCOORD4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord4i, PFNGLTEXCOORD4IPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord4iv, PFNGLTEXCOORD4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord4s, PFNGLTEXCOORD4SPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoord4sv, PFNGLTEXCOORD4SVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex2d, PFNGLVERTEX2DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex2dv, PFNGLVERTEX2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex2f, PFNGLVERTEX2FPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex2fv, PFNGLVERTEX2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex2i, PFNGLVERTEX2IPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex2iv, PFNGLVERTEX2IVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex2s, PFNGLVERTEX2SPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex2sv, PFNGLVERTEX2SVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex3d, PFNGLVERTEX3DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex3dv, PFNGLVERTEX3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex3f, PFNGLVERTEX3FPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex3fv, PFNGLVERTEX3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex3i, PFNGLVERTEX3IPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex3iv, PFNGLVERTEX3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex3s, PFNGLVERTEX3SPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex3sv, PFNGLVERTEX3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex4d, PFNGLVERTEX4DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex4dv, PFNGLVERTEX4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex4f, PFNGLVERTEX4FPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex4fv, PFNGLVERTEX4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex4i, PFNGLVERTEX4IPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex4iv, PFNGLVERTEX4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex4s, PFNGLVERTEX4SPROC)
+PS_HEADLESS_GL_FUNCTION(glVertex4sv, PFNGLVERTEX4SVPROC)
+PS_HEADLESS_GL_FUNCTION(glClipPlane, PFNGLCLIPPLANEPROC)
+PS_HEADLESS_GL_FUNCTION(glColorMaterial, PFNGLCOLORMATERIALPROC)
+PS_HEADLESS_GL_FUNCTION(glFogf, PFNGLFOGFPROC)
+PS_HEADLESS_GL_FUNCTION(glFogfv, PFNGLFOGFVPROC)
+PS_HEADLESS_GL_FUNCTION(glFogi, PFNGLFOGIPROC)
+PS_HEADLESS_GL_FUNCTION(glFogiv, PFNGLFOGIVPROC)
+PS_HEADLESS_GL_FUNCTION(glLightf, PFNGLLIGHTFPROC)
+PS_HEADLESS_GL_FUNCTION(glLightfv, PFNGLLIGHTFVPROC)
+PS_HEADLESS_GL_FUNCTION(glLighti, PFNGLLIGHTIPROC)
+PS_HEADLESS_GL_FUNCTION(glLightiv, PFNGLLIGHTIVPROC)
+PS_HEADLESS_GL_FUNCTION(glLightModelf, PFNGLLIGHTMODELFPROC)
+PS_HEADLESS_GL_FUNCTION(glLightModelfv, PFNGLLIGHTMODELFVPROC)
+PS_HEADLESS_GL_FUNCTION(glLightModeli, PFNGLLIGHTMODELIPROC)
+PS_HEADLESS_GL_FUNCTION(glLightModeliv, PFNGLLIGHTMODELIVPROC)
+PS_HEADLESS_GL_FUNCTION(glLineStipple, PFNGLLINESTIPPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glMaterialf, PFNGLMATERIALFPROC)
+PS_HEADLESS_GL_FUNCTION(glMaterialfv, PFNGLMATERIALFVPROC)
+PS_HEADLESS_GL_FUNCTION(glMateriali, PFNGLMATERIALIPROC)
+PS_HEADLESS_GL_FUNCTION(glMaterialiv, PFNGLMATERIALIVPROC)
+PS_HEADLESS_GL_FUNCTION(glPolygonStipple, PFNGLPOLYGONSTIPPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glShadeModel, PFNGLSHADEMODELPROC)
+PS_HEADLESS_GL_FUNCTION(glTexEnvf, PFNGLTEXENVFPROC)
+PS_HEADLESS_GL_FUNCTION(glTexEnvfv, PFNGLTEXENVFVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexEnvi, PFNGLTEXENVIPROC)
+PS_HEADLESS_GL_FUNCTION(glTexEnviv, PFNGLTEXENVIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexGend, PFNGLTEXGENDPROC)
+PS_HEADLESS_GL_FUNCTION(glTexGendv, PFNGLTEXGENDVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexGenf, PFNGLTEXGENFPROC)
+PS_HEADLESS_GL_FUNCTION(glTexGenfv, PFNGLTEXGENFVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexGeni, PFNGLTEXGENIPROC)
+PS_HEADLESS_GL_FUNCTION(glTexGeniv, PFNGLTEXGENIVPROC)
+PS_HEADLESS_GL_FUNCTION(glFeedbackBuffer, PFNGLFEEDBACKBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glSelectBuffer, PFNGLSELECTBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glRenderMode, PFNGLRENDERMODEPROC)
+PS_HEADLESS_GL_FUNCTION(glInitNames, PFNGLINITNAMESPROC)
+PS_HEADLESS_GL_FUNCTION(glLoadName, PFNGLLOADNAMEPROC)
+PS_HEADLESS_GL_FUNCTION(glPassThrough, PFNGLPASSTHROUGHPROC)
+PS_HEADLESS_GL_FUNCTION(glPopName, PFNGLPOPNAMEPROC)
+PS_HEADLESS_GL_FUNCTION(glPushName, PFNGLPUSHNAMEPROC)
+PS_HEADLESS_GL_FUNCTION(glClearAccum, PFNGLCLEARACCUMPROC)
+PS_HEADLESS_GL_FUNCTION(glClearIndex, PFNGLCLEARINDEXPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexMask, PFNGLINDEXMASKPROC)
+PS_HEADLESS_GL_FUNCTION(glAccum, PFNGLACCUMPROC)
+PS_HEADLESS_GL_FUNCTION(glPopAttrib, PFNGLPOPATTRIBPROC)
+PS_HEADLESS_GL_FUNCTION(glPushAttrib, PFNGLPUSHATTRIBPROC)
+PS_HEADLESS_GL_FUNCTION(glMap1d, PFNGLMAP1DPROC)
+PS_HEADLESS_GL_FUNCTION(glMap1f, PFNGLMAP1FPROC)
+PS_HEADLESS_GL_FUNCTION(glMap2d, PFNGLMAP2DPROC)
+PS_HEADLESS_GL_FUNCTION(glMap2f, PFNGLMAP2FPROC)
+PS_HEADLESS_GL_FUNCTION(glMapGrid1d, PFNGLMAPGRID1DPROC)
+PS_HEADLESS_GL_FUNCTION(glMapGrid1f, PFNGLMAPGRID1FPROC)
+PS_HEADLESS_GL_FUNCTION(glMapGrid2d, PFNGLMAPGRID2DPROC)
+PS_HEADLESS_GL_FUNCTION(glMapGrid2f, PFNGLMAPGRID2FPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalCoord1d, PFNGLEVALCOORD1DPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalCoord1dv, PFNGLEVALCOORD1DVPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalCoord1f, PFNGLEVALCOORD1FPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalCoord1fv, PFNGLEVALCOORD1FVPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalCoord2d, PFNGLEVALCOORD2DPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalCoord2dv, PFNGLEVALCOORD2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalCoord2f, PFNGLEVALCOORD2FPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalCoord2fv, PFNGLEVALCOORD2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glEvalMesh1, PFNGLEVALMESH1PROC)
+PS_HEADLESS_GL_FUNCTION(glEvalPoint1, PFNGLEVALPOINT1PROC)
+PS_HEADLESS_GL_FUNCTION(glEvalMesh2, PFNGLEVALMESH2PROC)
+PS_HEADLESS_GL_FUNCTION(glEvalPoint2, PFNGLEVALPOINT2PROC)
+PS_HEADLESS_GL_FUNCTION(glAlphaFunc, PFNGLALPHAFUNCPROC)
+PS_HEADLESS_GL_FUNCTION(glPixelZoom, PFNGLPIXELZOOMPROC)
+PS_HEADLESS_GL_FUNCTION(glPixelTransferf, PFNGLPIXELTRANSFERFPROC)
+PS_HEADLESS_GL_FUNCTION(glPixelTransferi, PFNGLPIXELTRANSFERIPROC)
+PS_HEADLESS_GL_FUNCTION(glPixelMapfv, PFNGLPIXELMAPFVPROC)
+PS_HEADLESS_GL_FUNCTION(glPixelMapuiv, PFNGLPIXELMAPUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glPixelMapusv, PFNGLPIXELMAPUSVPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyPixels, PFNGLCOPYPIXELSPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawPixels, PFNGLDRAWPIXELSPROC)
+PS_HEADLESS_GL_FUNCTION(glGetClipPlane, PFNGLGETCLIPPLANEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetLightfv, PFNGLGETLIGHTFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetLightiv, PFNGLGETLIGHTIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetMapdv, PFNGLGETMAPDVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetMapfv, PFNGLGETMAPFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetMapiv, PFNGLGETMAPIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetMaterialfv, PFNGLGETMATERIALFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetMaterialiv, PFNGLGETMATERIALIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetPixelMapfv, PFNGLGETPIXELMAPFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetPixelMapuiv, PFNGLGETPIXELMAPUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetPixelMapusv, PFNGLGETPIXELMAPUSVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetPolygonStipple, PFNGLGETPOLYGONSTIPPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexEnvfv, PFNGLGETTEXENVFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexEnviv, PFNGLGETTEXENVIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexGendv, PFNGLGETTEXGENDVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexGenfv, PFNGLGETTEXGENFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexGeniv, PFNGLGETTEXGENIVPROC)
+PS_HEADLESS_GL_FUNCTION(glIsList, PFNGLISLISTPROC)
+PS_HEADLESS_GL_FUNCTION(glFrustum, PFNGLFRUSTUMPROC)
+PS_HEADLESS_GL_FUNCTION(glLoadIdentity, PFNGLLOADIDENTITYPROC)
+PS_HEADLESS_GL_FUNCTION(glLoadMatrixf, PFNGLLOADMATRIXFPROC)
+PS_HEADLESS_GL_FUNCTION(glLoadMatrixd, PFNGLLOADMATRIXDPROC)
+PS_HEADLESS_GL_FUNCTION(glMatrixMode, PFNGLMATRIXMODEPROC)
+PS_HEADLESS_GL_FUNCTION(glMultMatrixf, PFNGLMULTMATRIXFPROC)
+PS_HEADLESS_GL_FUNCTION(glMultMatrixd, PFNGLMULTMATRIXDPROC)
+PS_HEADLESS_GL_FUNCTION(glOrtho, PFNGLORTHOPROC)
+PS_HEADLESS_GL_FUNCTION(glPopMatrix, PFNGLPOPMATRIXPROC)
+PS_HEADLESS_GL_FUNCTION(glPushMatrix, PFNGLPUSHMATRIXPROC)
+PS_HEADLESS_GL_FUNCTION(glRotated, PFNGLROTATEDPROC)
+PS_HEADLESS_GL_FUNCTION(glRotatef, PFNGLROTATEFPROC)
+PS_HEADLESS_GL_FUNCTION(glScaled, PFNGLSCALEDPROC)
+PS_HEADLESS_GL_FUNCTION(glScalef, PFNGLSCALEFPROC)
+PS_HEADLESS_GL_FUNCTION(glTranslated, PFNGLTRANSLATEDPROC)
+PS_HEADLESS_GL_FUNCTION(glTranslatef, PFNGLTRANSLATEFPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawArrays, PFNGLDRAWARRAYSPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawElements, PFNGLDRAWELEMENTSPROC)
+PS_HEADLESS_GL_FUNCTION(glGetPointerv, PFNGLGETPOINTERVPROC)
+PS_HEADLESS_GL_FUNCTION(glPolygonOffset, PFNGLPOLYGONOFFSETPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glBindTexture, PFNGLBINDTEXTUREPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteTextures, PFNGLDELETETEXTURESPROC)
+PS_HEADLESS_GL_FUNCTION(glGenTextures, PFNGLGENTEXTURESPROC)
+PS_HEADLESS_GL_FUNCTION(glIsTexture, PFNGLISTEXTUREPROC)
+PS_HEADLESS_GL_FUNCTION(glArrayElement, PFNGLARRAYELEMENTPROC)
+PS_HEADLESS_GL_FUNCTION(glColorPointer, PFNGLCOLORPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glDisableClientState, PFNGLDISABLECLIENTSTATEPROC)
+PS_HEADLESS_GL_FUNCTION(glEdgeFlagPointer, PFNGLEDGEFLAGPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glEnableClientState, PFNGLENABLECLIENTSTATEPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexPointer, PFNGLINDEXPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glInterleavedArrays, PFNGLINTERLEAVEDARRAYSPROC)
+PS_HEADLESS_GL_FUNCTION(glNormalPointer, PFNGLNORMALPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordPointer, PFNGLTEXCOORDPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexPointer, PFNGLVERTEXPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glAreTexturesResident, PFNGLARETEXTURESRESIDENTPROC)
+PS_HEADLESS_GL_FUNCTION(glPrioritizeTextures, PFNGLPRIORITIZETEXTURESPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexub, PFNGLINDEXUBPROC)
+PS_HEADLESS_GL_FUNCTION(glIndexubv, PFNGLINDEXUBVPROC)
+PS_HEADLESS_GL_FUNCTION(glPopClientAttrib, PFNGLPOPCLIENTATTRIBPROC)
+PS_HEADLESS_GL_FUNCTION(glPushClientAttrib, PFNGLPUSHCLIENTATTRIBPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC)
+PS_HEADLESS_GL_FUNCTION(glTexImage3D, PFNGLTEXIMAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glActiveTexture, PFNGLACTIVETEXTUREPROC)
+PS_HEADLESS_GL_FUNCTION(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glClientActiveTexture, PFNGLCLIENTACTIVETEXTUREPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord1d, PFNGLMULTITEXCOORD1DPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord1dv, PFNGLMULTITEXCOORD1DVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord1f, PFNGLMULTITEXCOORD1FPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord1fv, PFNGLMULTITEXCOORD1FVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord1i, PFNGLMULTITEXCOORD1IPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord1iv, PFNGLMULTITEXCOORD1IVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord1s, PFNGLMULTITEXCOORD1SPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord1sv, PFNGLMULTITEXCOORD1SVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord2d, PFNGLMULTITEXCOORD2DPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord2dv, PFNGLMULTITEXCOORD2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord2f, PFNGLMULTITEXCOORD2FPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord2fv, PFNGLMULTITEXCOORD2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord2i, PFNGLMULTITEXCOORD2IPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord2iv, PFNGLMULTITEXCOORD2IVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord2s, PFNGLMULTITEXCOORD2SPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord2sv, PFNGLMULTITEXCOORD2SVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord3d, PFNGLMULTITEXCOORD3DPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord3dv, PFNGLMULTITEXCOORD3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord3f, PFNGLMULTITEXCOORD3FPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord3fv, PFNGLMULTITEXCOORD3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord3i, PFNGLMULTITEXCOORD3IPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord3iv, PFNGLMULTITEXCOORD3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord3s, PFNGLMULTITEXCOORD3SPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord3sv, PFNGLMULTITEXCOORD3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4d, PFNGLMULTITEXCOORD4DPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4dv, PFNGLMULTITEXCOORD4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4f, PFNGLMULTITEXCOORD4FPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4fv, PFNGLMULTITEXCOORD4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4i, PFNGLMULTITEXCOORD4IPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4iv, PFNGLMULTITEXCOORD4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4s, PFNGLMULTITEXCOORD4SPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4sv, PFNGLMULTITEXCOORD4SVPROC)
+PS_HEADLESS_GL_FUNCTION(glLoadTransposeMatrixf, PFNGLLOADTRANSPOSEMATRIXFPROC)
+PS_HEADLESS_GL_FUNCTION(glLoadTransposeMatrixd, PFNGLLOADTRANSPOSEMATRIXDPROC)
+PS_HEADLESS_GL_FUNCTION(glMultTransposeMatrixf, PFNGLMULTTRANSPOSEMATRIXFPROC)
+PS_HEADLESS_GL_FUNCTION(glMultTransposeMatrixd, PFNGLMULTTRANSPOSEMATRIXDPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC)
+PS_HEADLESS_GL_FUNCTION(glPointParameterf, PFNGLPOINTPARAMETERFPROC)
+PS_HEADLESS_GL_FUNCTION(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glPointParameteri, PFNGLPOINTPARAMETERIPROC)
+PS_HEADLESS_GL_FUNCTION(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glFogCoordf, PFNGLFOGCOORDFPROC)
+PS_HEADLESS_GL_FUNCTION(glFogCoordfv, PFNGLFOGCOORDFVPROC)
+PS_HEADLESS_GL_FUNCTION(glFogCoordd, PFNGLFOGCOORDDPROC)
+PS_HEADLESS_GL_FUNCTION(glFogCoorddv, PFNGLFOGCOORDDVPROC)
+PS_HEADLESS_GL_FUNCTION(glFogCoordPointer, PFNGLFOGCOORDPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3b, PFNGLSECONDARYCOLOR3BPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3bv, PFNGLSECONDARYCOLOR3BVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3d, PFNGLSECONDARYCOLOR3DPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3dv, PFNGLSECONDARYCOLOR3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3f, PFNGLSECONDARYCOLOR3FPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3fv, PFNGLSECONDARYCOLOR3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3i, PFNGLSECONDARYCOLOR3IPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3iv, PFNGLSECONDARYCOLOR3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3s, PFNGLSECONDARYCOLOR3SPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3sv, PFNGLSECONDARYCOLOR3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3ub, PFNGLSECONDARYCOLOR3UBPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3ubv, PFNGLSECONDARYCOLOR3UBVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3ui, PFNGLSECONDARYCOLOR3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3uiv, PFNGLSECONDARYCOLOR3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3us, PFNGLSECONDARYCOLOR3USPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColor3usv, PFNGLSECONDARYCOLOR3USVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColorPointer, PFNGLSECONDARYCOLORPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos2d, PFNGLWINDOWPOS2DPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos2dv, PFNGLWINDOWPOS2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos2f, PFNGLWINDOWPOS2FPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos2fv, PFNGLWINDOWPOS2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos2i, PFNGLWINDOWPOS2IPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos2iv, PFNGLWINDOWPOS2IVPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos2s, PFNGLWINDOWPOS2SPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos2sv, PFNGLWINDOWPOS2SVPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos3d, PFNGLWINDOWPOS3DPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos3dv, PFNGLWINDOWPOS3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos3f, PFNGLWINDOWPOS3FPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos3fv, PFNGLWINDOWPOS3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos3i, PFNGLWINDOWPOS3IPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos3iv, PFNGLWINDOWPOS3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos3s, PFNGLWINDOWPOS3SPROC)
+PS_HEADLESS_GL_FUNCTION(glWindowPos3sv, PFNGLWINDOWPOS3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendColor, PFNGLBLENDCOLORPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendEquation, PFNGLBLENDEQUATIONPROC)
+PS_HEADLESS_GL_FUNCTION(glGenQueries, PFNGLGENQUERIESPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteQueries, PFNGLDELETEQUERIESPROC)
+PS_HEADLESS_GL_FUNCTION(glIsQuery, PFNGLISQUERYPROC)
+PS_HEADLESS_GL_FUNCTION(glBeginQuery, PFNGLBEGINQUERYPROC)
+PS_HEADLESS_GL_FUNCTION(glEndQuery, PFNGLENDQUERYPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryiv, PFNGLGETQUERYIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glBindBuffer, PFNGLBINDBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteBuffers, PFNGLDELETEBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glGenBuffers, PFNGLGENBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glIsBuffer, PFNGLISBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glBufferData, PFNGLBUFFERDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glBufferSubData, PFNGLBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glMapBuffer, PFNGLMAPBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glUnmapBuffer, PFNGLUNMAPBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawBuffers, PFNGLDRAWBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC)
+PS_HEADLESS_GL_FUNCTION(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC)
+PS_HEADLESS_GL_FUNCTION(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC)
+PS_HEADLESS_GL_FUNCTION(glAttachShader, PFNGLATTACHSHADERPROC)
+PS_HEADLESS_GL_FUNCTION(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC)
+PS_HEADLESS_GL_FUNCTION(glCompileShader, PFNGLCOMPILESHADERPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateProgram, PFNGLCREATEPROGRAMPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateShader, PFNGLCREATESHADERPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteProgram, PFNGLDELETEPROGRAMPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteShader, PFNGLDELETESHADERPROC)
+PS_HEADLESS_GL_FUNCTION(glDetachShader, PFNGLDETACHSHADERPROC)
+PS_HEADLESS_GL_FUNCTION(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC)
+PS_HEADLESS_GL_FUNCTION(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC)
+PS_HEADLESS_GL_FUNCTION(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC)
+PS_HEADLESS_GL_FUNCTION(glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramiv, PFNGLGETPROGRAMIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC)
+PS_HEADLESS_GL_FUNCTION(glGetShaderiv, PFNGLGETSHADERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC)
+PS_HEADLESS_GL_FUNCTION(glGetShaderSource, PFNGLGETSHADERSOURCEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC)
+PS_HEADLESS_GL_FUNCTION(glGetUniformfv, PFNGLGETUNIFORMFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetUniformiv, PFNGLGETUNIFORMIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC)
+PS_HEADLESS_GL_FUNCTION(glIsProgram, PFNGLISPROGRAMPROC)
+PS_HEADLESS_GL_FUNCTION(glIsShader, PFNGLISSHADERPROC)
+PS_HEADLESS_GL_FUNCTION(glLinkProgram, PFNGLLINKPROGRAMPROC)
+PS_HEADLESS_GL_FUNCTION(glShaderSource, PFNGLSHADERSOURCEPROC)
+PS_HEADLESS_GL_FUNCTION(glUseProgram, PFNGLUSEPROGRAMPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform1f, PFNGLUNIFORM1FPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform2f, PFNGLUNIFORM2FPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform3f, PFNGLUNIFORM3FPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform4f, PFNGLUNIFORM4FPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform1i, PFNGLUNIFORM1IPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform2i, PFNGLUNIFORM2IPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform3i, PFNGLUNIFORM3IPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform4i, PFNGLUNIFORM4IPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform1fv, PFNGLUNIFORM1FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform2fv, PFNGLUNIFORM2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform3fv, PFNGLUNIFORM3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform4fv, PFNGLUNIFORM4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform1iv, PFNGLUNIFORM1IVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform2iv, PFNGLUNIFORM2IVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform3iv, PFNGLUNIFORM3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform4iv, PFNGLUNIFORM4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glValidateProgram, PFNGLVALIDATEPROGRAMPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glColorMaski, PFNGLCOLORMASKIPROC)
+PS_HEADLESS_GL_FUNCTION(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC)
+PS_HEADLESS_GL_FUNCTION(glEnablei, PFNGLENABLEIPROC)
+PS_HEADLESS_GL_FUNCTION(glDisablei, PFNGLDISABLEIPROC)
+PS_HEADLESS_GL_FUNCTION(glIsEnabledi, PFNGLISENABLEDIPROC)
+PS_HEADLESS_GL_FUNCTION(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC)
+PS_HEADLESS_GL_FUNCTION(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC)
+PS_HEADLESS_GL_FUNCTION(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glBindBufferBase, PFNGLBINDBUFFERBASEPROC)
+PS_HEADLESS_GL_FUNCTION(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)
+PS_HEADLESS_GL_FUNCTION(glClampColor, PFNGLCLAMPCOLORPROC)
+PS_HEADLESS_GL_FUNCTION(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC)
+PS_HEADLESS_GL_FUNCTION(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC)
+PS_HEADLESS_GL_FUNCTION(glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform1ui, PFNGLUNIFORM1UIPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform2ui, PFNGLUNIFORM2UIPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform3ui, PFNGLUNIFORM3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform4ui, PFNGLUNIFORM4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform1uiv, PFNGLUNIFORM1UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform2uiv, PFNGLUNIFORM2UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform3uiv, PFNGLUNIFORM3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform4uiv, PFNGLUNIFORM4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glClearBufferiv, PFNGLCLEARBUFFERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glClearBufferfv, PFNGLCLEARBUFFERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glClearBufferfi, PFNGLCLEARBUFFERFIPROC)
+PS_HEADLESS_GL_FUNCTION(glGetStringi, PFNGLGETSTRINGIPROC)
+PS_HEADLESS_GL_FUNCTION(glIsRenderbuffer, PFNGLISRENDERBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glIsFramebuffer, PFNGLISFRAMEBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC)
+PS_HEADLESS_GL_FUNCTION(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC)
+PS_HEADLESS_GL_FUNCTION(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC)
+PS_HEADLESS_GL_FUNCTION(glMapBufferRange, PFNGLMAPBUFFERRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC)
+PS_HEADLESS_GL_FUNCTION(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC)
+PS_HEADLESS_GL_FUNCTION(glIsVertexArray, PFNGLISVERTEXARRAYPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC)
+PS_HEADLESS_GL_FUNCTION(glTexBuffer, PFNGLTEXBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)
+PS_HEADLESS_GL_FUNCTION(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC)
+PS_HEADLESS_GL_FUNCTION(glFenceSync, PFNGLFENCESYNCPROC)
+PS_HEADLESS_GL_FUNCTION(glIsSync, PFNGLISSYNCPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteSync, PFNGLDELETESYNCPROC)
+PS_HEADLESS_GL_FUNCTION(glClientWaitSync, PFNGLCLIENTWAITSYNCPROC)
+PS_HEADLESS_GL_FUNCTION(glWaitSync, PFNGLWAITSYNCPROC)
+PS_HEADLESS_GL_FUNCTION(glGetInteger64v, PFNGLGETINTEGER64VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetSynciv, PFNGLGETSYNCIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC)
+PS_HEADLESS_GL_FUNCTION(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC)
+PS_HEADLESS_GL_FUNCTION(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC)
+PS_HEADLESS_GL_FUNCTION(glSampleMaski, PFNGLSAMPLEMASKIPROC)
+PS_HEADLESS_GL_FUNCTION(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)
+PS_HEADLESS_GL_FUNCTION(glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC)
+PS_HEADLESS_GL_FUNCTION(glGenSamplers, PFNGLGENSAMPLERSPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteSamplers, PFNGLDELETESAMPLERSPROC)
+PS_HEADLESS_GL_FUNCTION(glIsSampler, PFNGLISSAMPLERPROC)
+PS_HEADLESS_GL_FUNCTION(glBindSampler, PFNGLBINDSAMPLERPROC)
+PS_HEADLESS_GL_FUNCTION(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC)
+PS_HEADLESS_GL_FUNCTION(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC)
+PS_HEADLESS_GL_FUNCTION(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC)
+PS_HEADLESS_GL_FUNCTION(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glQueryCounter, PFNGLQUERYCOUNTERPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexP2ui, PFNGLVERTEXP2UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexP2uiv, PFNGLVERTEXP2UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexP3ui, PFNGLVERTEXP3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexP3uiv, PFNGLVERTEXP3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexP4ui, PFNGLVERTEXP4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexP4uiv, PFNGLVERTEXP4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glNormalP3ui, PFNGLNORMALP3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glNormalP3uiv, PFNGLNORMALP3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glColorP3ui, PFNGLCOLORP3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glColorP3uiv, PFNGLCOLORP3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glColorP4ui, PFNGLCOLORP4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glColorP4uiv, PFNGLCOLORP4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glMinSampleShading, PFNGLMINSAMPLESHADINGPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendEquationi, PFNGLBLENDEQUATIONIPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendEquationSeparatei, PFNGLBLENDEQUATIONSEPARATEIPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendFunci, PFNGLBLENDFUNCIPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendFuncSeparatei, PFNGLBLENDFUNCSEPARATEIPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform1d, PFNGLUNIFORM1DPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform2d, PFNGLUNIFORM2DPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform3d, PFNGLUNIFORM3DPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform4d, PFNGLUNIFORM4DPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform1dv, PFNGLUNIFORM1DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform2dv, PFNGLUNIFORM2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform3dv, PFNGLUNIFORM3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniform4dv, PFNGLUNIFORM4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix2dv, PFNGLUNIFORMMATRIX2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix3dv, PFNGLUNIFORMMATRIX3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix4dv, PFNGLUNIFORMMATRIX4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix2x3dv, PFNGLUNIFORMMATRIX2X3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix2x4dv, PFNGLUNIFORMMATRIX2X4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix3x2dv, PFNGLUNIFORMMATRIX3X2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix3x4dv, PFNGLUNIFORMMATRIX3X4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix4x2dv, PFNGLUNIFORMMATRIX4X2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformMatrix4x3dv, PFNGLUNIFORMMATRIX4X3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetUniformdv, PFNGLGETUNIFORMDVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetSubroutineUniformLocation, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)
+PS_HEADLESS_GL_FUNCTION(glGetSubroutineIndex, PFNGLGETSUBROUTINEINDEXPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveSubroutineUniformiv, PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveSubroutineUniformName, PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveSubroutineName, PFNGLGETACTIVESUBROUTINENAMEPROC)
+PS_HEADLESS_GL_FUNCTION(glUniformSubroutinesuiv, PFNGLUNIFORMSUBROUTINESUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetUniformSubroutineuiv, PFNGLGETUNIFORMSUBROUTINEUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramStageiv, PFNGLGETPROGRAMSTAGEIVPROC)
+PS_HEADLESS_GL_FUNCTION(glPatchParameteri, PFNGLPATCHPARAMETERIPROC)
+PS_HEADLESS_GL_FUNCTION(glPatchParameterfv, PFNGLPATCHPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glBindTransformFeedback, PFNGLBINDTRANSFORMFEEDBACKPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteTransformFeedbacks, PFNGLDELETETRANSFORMFEEDBACKSPROC)
+PS_HEADLESS_GL_FUNCTION(glGenTransformFeedbacks, PFNGLGENTRANSFORMFEEDBACKSPROC)
+PS_HEADLESS_GL_FUNCTION(glIsTransformFeedback, PFNGLISTRANSFORMFEEDBACKPROC)
+PS_HEADLESS_GL_FUNCTION(glPauseTransformFeedback, PFNGLPAUSETRANSFORMFEEDBACKPROC)
+PS_HEADLESS_GL_FUNCTION(glResumeTransformFeedback, PFNGLRESUMETRANSFORMFEEDBACKPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawTransformFeedback, PFNGLDRAWTRANSFORMFEEDBACKPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawTransformFeedbackStream, PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)
+PS_HEADLESS_GL_FUNCTION(glBeginQueryIndexed, PFNGLBEGINQUERYINDEXEDPROC)
+PS_HEADLESS_GL_FUNCTION(glEndQueryIndexed, PFNGLENDQUERYINDEXEDPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryIndexediv, PFNGLGETQUERYINDEXEDIVPROC)
+PS_HEADLESS_GL_FUNCTION(glReleaseShaderCompiler, PFNGLRELEASESHADERCOMPILERPROC)
+PS_HEADLESS_GL_FUNCTION(glShaderBinary, PFNGLSHADERBINARYPROC)
+PS_HEADLESS_GL_FUNCTION(glGetShaderPrecisionFormat, PFNGLGETSHADERPRECISIONFORMATPROC)
+PS_HEADLESS_GL_FUNCTION(glDepthRangef, PFNGLDEPTHRANGEFPROC)
+PS_HEADLESS_GL_FUNCTION(glClearDepthf, PFNGLCLEARDEPTHFPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramBinary, PFNGLPROGRAMBINARYPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC)
+PS_HEADLESS_GL_FUNCTION(glUseProgramStages, PFNGLUSEPROGRAMSTAGESPROC)
+PS_HEADLESS_GL_FUNCTION(glActiveShaderProgram, PFNGLACTIVESHADERPROGRAMPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateShaderProgramv, PFNGLCREATESHADERPROGRAMVPROC)
+PS_HEADLESS_GL_FUNCTION(glBindProgramPipeline, PFNGLBINDPROGRAMPIPELINEPROC)
+PS_HEADLESS_GL_FUNCTION(glDeleteProgramPipelines, PFNGLDELETEPROGRAMPIPELINESPROC)
+PS_HEADLESS_GL_FUNCTION(glGenProgramPipelines, PFNGLGENPROGRAMPIPELINESPROC)
+PS_HEADLESS_GL_FUNCTION(glIsProgramPipeline, PFNGLISPROGRAMPIPELINEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramPipelineiv, PFNGLGETPROGRAMPIPELINEIVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform1i, PFNGLPROGRAMUNIFORM1IPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform1iv, PFNGLPROGRAMUNIFORM1IVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform1f, PFNGLPROGRAMUNIFORM1FPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform1fv, PFNGLPROGRAMUNIFORM1FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform1d, PFNGLPROGRAMUNIFORM1DPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform1dv, PFNGLPROGRAMUNIFORM1DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform1ui, PFNGLPROGRAMUNIFORM1UIPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform1uiv, PFNGLPROGRAMUNIFORM1UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform2i, PFNGLPROGRAMUNIFORM2IPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform2iv, PFNGLPROGRAMUNIFORM2IVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform2f, PFNGLPROGRAMUNIFORM2FPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform2fv, PFNGLPROGRAMUNIFORM2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform2d, PFNGLPROGRAMUNIFORM2DPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform2dv, PFNGLPROGRAMUNIFORM2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform2ui, PFNGLPROGRAMUNIFORM2UIPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform2uiv, PFNGLPROGRAMUNIFORM2UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform3i, PFNGLPROGRAMUNIFORM3IPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform3iv, PFNGLPROGRAMUNIFORM3IVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform3f, PFNGLPROGRAMUNIFORM3FPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform3fv, PFNGLPROGRAMUNIFORM3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform3d, PFNGLPROGRAMUNIFORM3DPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform3dv, PFNGLPROGRAMUNIFORM3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform3ui, PFNGLPROGRAMUNIFORM3UIPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform3uiv, PFNGLPROGRAMUNIFORM3UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform4i, PFNGLPROGRAMUNIFORM4IPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform4iv, PFNGLPROGRAMUNIFORM4IVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform4f, PFNGLPROGRAMUNIFORM4FPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform4fv, PFNGLPROGRAMUNIFORM4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform4d, PFNGLPROGRAMUNIFORM4DPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform4dv, PFNGLPROGRAMUNIFORM4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform4ui, PFNGLPROGRAMUNIFORM4UIPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniform4uiv, PFNGLPROGRAMUNIFORM4UIVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix2fv, PFNGLPROGRAMUNIFORMMATRIX2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix3fv, PFNGLPROGRAMUNIFORMMATRIX3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix4fv, PFNGLPROGRAMUNIFORMMATRIX4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix2dv, PFNGLPROGRAMUNIFORMMATRIX2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix3dv, PFNGLPROGRAMUNIFORMMATRIX3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix4dv, PFNGLPROGRAMUNIFORMMATRIX4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix2x3fv, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix3x2fv, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix2x4fv, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix4x2fv, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix3x4fv, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix4x3fv, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix2x3dv, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix3x2dv, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix2x4dv, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix4x2dv, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix3x4dv, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glProgramUniformMatrix4x3dv, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glValidateProgramPipeline, PFNGLVALIDATEPROGRAMPIPELINEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramPipelineInfoLog, PFNGLGETPROGRAMPIPELINEINFOLOGPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribL1d, PFNGLVERTEXATTRIBL1DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribL2d, PFNGLVERTEXATTRIBL2DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribL3d, PFNGLVERTEXATTRIBL3DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribL4d, PFNGLVERTEXATTRIBL4DPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribL1dv, PFNGLVERTEXATTRIBL1DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribL2dv, PFNGLVERTEXATTRIBL2DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribL3dv, PFNGLVERTEXATTRIBL3DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribL4dv, PFNGLVERTEXATTRIBL4DVPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribLPointer, PFNGLVERTEXATTRIBLPOINTERPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexAttribLdv, PFNGLGETVERTEXATTRIBLDVPROC)
+PS_HEADLESS_GL_FUNCTION(glViewportArrayv, PFNGLVIEWPORTARRAYVPROC)
+PS_HEADLESS_GL_FUNCTION(glViewportIndexedf, PFNGLVIEWPORTINDEXEDFPROC)
+PS_HEADLESS_GL_FUNCTION(glViewportIndexedfv, PFNGLVIEWPORTINDEXEDFVPROC)
+PS_HEADLESS_GL_FUNCTION(glScissorArrayv, PFNGLSCISSORARRAYVPROC)
+PS_HEADLESS_GL_FUNCTION(glScissorIndexed, PFNGLSCISSORINDEXEDPROC)
+PS_HEADLESS_GL_FUNCTION(glScissorIndexedv, PFNGLSCISSORINDEXEDVPROC)
+PS_HEADLESS_GL_FUNCTION(glDepthRangeArrayv, PFNGLDEPTHRANGEARRAYVPROC)
+PS_HEADLESS_GL_FUNCTION(glDepthRangeIndexed, PFNGLDEPTHRANGEINDEXEDPROC)
+PS_HEADLESS_GL_FUNCTION(glGetFloati_v, PFNGLGETFLOATI_VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetDoublei_v, PFNGLGETDOUBLEI_VPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawArraysInstancedBaseInstance, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawElementsInstancedBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawElementsInstancedBaseVertexBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetInternalformativ, PFNGLGETINTERNALFORMATIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetActiveAtomicCounterBufferiv, PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glBindImageTexture, PFNGLBINDIMAGETEXTUREPROC)
+PS_HEADLESS_GL_FUNCTION(glMemoryBarrier, PFNGLMEMORYBARRIERPROC)
+PS_HEADLESS_GL_FUNCTION(glTexStorage1D, PFNGLTEXSTORAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexStorage2D, PFNGLTEXSTORAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glTexStorage3D, PFNGLTEXSTORAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawTransformFeedbackInstanced, PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)
+PS_HEADLESS_GL_FUNCTION(glDrawTransformFeedbackStreamInstanced, PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)
+PS_HEADLESS_GL_FUNCTION(glClearBufferData, PFNGLCLEARBUFFERDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glClearBufferSubData, PFNGLCLEARBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glDispatchCompute, PFNGLDISPATCHCOMPUTEPROC)
+PS_HEADLESS_GL_FUNCTION(glDispatchComputeIndirect, PFNGLDISPATCHCOMPUTEINDIRECTPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyImageSubData, PFNGLCOPYIMAGESUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glFramebufferParameteri, PFNGLFRAMEBUFFERPARAMETERIPROC)
+PS_HEADLESS_GL_FUNCTION(glGetFramebufferParameteriv, PFNGLGETFRAMEBUFFERPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetInternalformati64v, PFNGLGETINTERNALFORMATI64VPROC)
+PS_HEADLESS_GL_FUNCTION(glInvalidateTexSubImage, PFNGLINVALIDATETEXSUBIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glInvalidateTexImage, PFNGLINVALIDATETEXIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glInvalidateBufferSubData, PFNGLINVALIDATEBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glInvalidateBufferData, PFNGLINVALIDATEBUFFERDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glInvalidateFramebuffer, PFNGLINVALIDATEFRAMEBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glInvalidateSubFramebuffer, PFNGLINVALIDATESUBFRAMEBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramInterfaceiv, PFNGLGETPROGRAMINTERFACEIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramResourceIndex, PFNGLGETPROGRAMRESOURCEINDEXPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramResourceName, PFNGLGETPROGRAMRESOURCENAMEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramResourceiv, PFNGLGETPROGRAMRESOURCEIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramResourceLocation, PFNGLGETPROGRAMRESOURCELOCATIONPROC)
+PS_HEADLESS_GL_FUNCTION(glGetProgramResourceLocationIndex, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)
+PS_HEADLESS_GL_FUNCTION(glShaderStorageBlockBinding, PFNGLSHADERSTORAGEBLOCKBINDINGPROC)
+PS_HEADLESS_GL_FUNCTION(glTexBufferRange, PFNGLTEXBUFFERRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glTexStorage2DMultisample, PFNGLTEXSTORAGE2DMULTISAMPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glTexStorage3DMultisample, PFNGLTEXSTORAGE3DMULTISAMPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureView, PFNGLTEXTUREVIEWPROC)
+PS_HEADLESS_GL_FUNCTION(glBindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribLFormat, PFNGLVERTEXATTRIBLFORMATPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC)
+PS_HEADLESS_GL_FUNCTION(glDebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC)
+PS_HEADLESS_GL_FUNCTION(glDebugMessageInsert, PFNGLDEBUGMESSAGEINSERTPROC)
+PS_HEADLESS_GL_FUNCTION(glDebugMessageCallback, PFNGLDEBUGMESSAGECALLBACKPROC)
+PS_HEADLESS_GL_FUNCTION(glGetDebugMessageLog, PFNGLGETDEBUGMESSAGELOGPROC)
+PS_HEADLESS_GL_FUNCTION(glPushDebugGroup, PFNGLPUSHDEBUGGROUPPROC)
+PS_HEADLESS_GL_FUNCTION(glPopDebugGroup, PFNGLPOPDEBUGGROUPPROC)
+PS_HEADLESS_GL_FUNCTION(glObjectLabel, PFNGLOBJECTLABELPROC)
+PS_HEADLESS_GL_FUNCTION(glGetObjectLabel, PFNGLGETOBJECTLABELPROC)
+PS_HEADLESS_GL_FUNCTION(glObjectPtrLabel, PFNGLOBJECTPTRLABELPROC)
+PS_HEADLESS_GL_FUNCTION(glGetObjectPtrLabel, PFNGLGETOBJECTPTRLABELPROC)
+PS_HEADLESS_GL_FUNCTION(glBufferStorage, PFNGLBUFFERSTORAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glClearTexImage, PFNGLCLEARTEXIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glClearTexSubImage, PFNGLCLEARTEXSUBIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glBindBuffersBase, PFNGLBINDBUFFERSBASEPROC)
+PS_HEADLESS_GL_FUNCTION(glBindBuffersRange, PFNGLBINDBUFFERSRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glBindTextures, PFNGLBINDTEXTURESPROC)
+PS_HEADLESS_GL_FUNCTION(glBindSamplers, PFNGLBINDSAMPLERSPROC)
+PS_HEADLESS_GL_FUNCTION(glBindImageTextures, PFNGLBINDIMAGETEXTURESPROC)
+PS_HEADLESS_GL_FUNCTION(glBindVertexBuffers, PFNGLBINDVERTEXBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glClipControl, PFNGLCLIPCONTROLPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateTransformFeedbacks, PFNGLCREATETRANSFORMFEEDBACKSPROC)
+PS_HEADLESS_GL_FUNCTION(glTransformFeedbackBufferBase, PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)
+PS_HEADLESS_GL_FUNCTION(glTransformFeedbackBufferRange, PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTransformFeedbackiv, PFNGLGETTRANSFORMFEEDBACKIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTransformFeedbacki_v, PFNGLGETTRANSFORMFEEDBACKI_VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTransformFeedbacki64_v, PFNGLGETTRANSFORMFEEDBACKI64_VPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateBuffers, PFNGLCREATEBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedBufferStorage, PFNGLNAMEDBUFFERSTORAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedBufferData, PFNGLNAMEDBUFFERDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedBufferSubData, PFNGLNAMEDBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyNamedBufferSubData, PFNGLCOPYNAMEDBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glClearNamedBufferData, PFNGLCLEARNAMEDBUFFERDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glClearNamedBufferSubData, PFNGLCLEARNAMEDBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glMapNamedBuffer, PFNGLMAPNAMEDBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glMapNamedBufferRange, PFNGLMAPNAMEDBUFFERRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glUnmapNamedBuffer, PFNGLUNMAPNAMEDBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glFlushMappedNamedBufferRange, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetNamedBufferParameteriv, PFNGLGETNAMEDBUFFERPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetNamedBufferParameteri64v, PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetNamedBufferPointerv, PFNGLGETNAMEDBUFFERPOINTERVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetNamedBufferSubData, PFNGLGETNAMEDBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateFramebuffers, PFNGLCREATEFRAMEBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedFramebufferRenderbuffer, PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedFramebufferParameteri, PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedFramebufferTexture, PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedFramebufferTextureLayer, PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedFramebufferDrawBuffer, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedFramebufferDrawBuffers, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedFramebufferReadBuffer, PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glInvalidateNamedFramebufferData, PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glInvalidateNamedFramebufferSubData, PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)
+PS_HEADLESS_GL_FUNCTION(glClearNamedFramebufferiv, PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glClearNamedFramebufferuiv, PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glClearNamedFramebufferfv, PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glClearNamedFramebufferfi, PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)
+PS_HEADLESS_GL_FUNCTION(glBlitNamedFramebuffer, PFNGLBLITNAMEDFRAMEBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glCheckNamedFramebufferStatus, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)
+PS_HEADLESS_GL_FUNCTION(glGetNamedFramebufferParameteriv, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetNamedFramebufferAttachmentParameteriv, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateRenderbuffers, PFNGLCREATERENDERBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedRenderbufferStorage, PFNGLNAMEDRENDERBUFFERSTORAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glNamedRenderbufferStorageMultisample, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetNamedRenderbufferParameteriv, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateTextures, PFNGLCREATETEXTURESPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureBuffer, PFNGLTEXTUREBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureBufferRange, PFNGLTEXTUREBUFFERRANGEPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureStorage1D, PFNGLTEXTURESTORAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureStorage2D, PFNGLTEXTURESTORAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureStorage3D, PFNGLTEXTURESTORAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureStorage2DMultisample, PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureStorage3DMultisample, PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureSubImage1D, PFNGLTEXTURESUBIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureSubImage2D, PFNGLTEXTURESUBIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureSubImage3D, PFNGLTEXTURESUBIMAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTextureSubImage1D, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTextureSubImage2D, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glCompressedTextureSubImage3D, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyTextureSubImage1D, PFNGLCOPYTEXTURESUBIMAGE1DPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyTextureSubImage2D, PFNGLCOPYTEXTURESUBIMAGE2DPROC)
+PS_HEADLESS_GL_FUNCTION(glCopyTextureSubImage3D, PFNGLCOPYTEXTURESUBIMAGE3DPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureParameterf, PFNGLTEXTUREPARAMETERFPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureParameterfv, PFNGLTEXTUREPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureParameteri, PFNGLTEXTUREPARAMETERIPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureParameterIiv, PFNGLTEXTUREPARAMETERIIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureParameterIuiv, PFNGLTEXTUREPARAMETERIUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureParameteriv, PFNGLTEXTUREPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGenerateTextureMipmap, PFNGLGENERATETEXTUREMIPMAPPROC)
+PS_HEADLESS_GL_FUNCTION(glBindTextureUnit, PFNGLBINDTEXTUREUNITPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTextureImage, PFNGLGETTEXTUREIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetCompressedTextureImage, PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTextureLevelParameterfv, PFNGLGETTEXTURELEVELPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTextureLevelParameteriv, PFNGLGETTEXTURELEVELPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTextureParameterfv, PFNGLGETTEXTUREPARAMETERFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTextureParameterIiv, PFNGLGETTEXTUREPARAMETERIIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTextureParameterIuiv, PFNGLGETTEXTUREPARAMETERIUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTextureParameteriv, PFNGLGETTEXTUREPARAMETERIVPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateVertexArrays, PFNGLCREATEVERTEXARRAYSPROC)
+PS_HEADLESS_GL_FUNCTION(glDisableVertexArrayAttrib, PFNGLDISABLEVERTEXARRAYATTRIBPROC)
+PS_HEADLESS_GL_FUNCTION(glEnableVertexArrayAttrib, PFNGLENABLEVERTEXARRAYATTRIBPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexArrayElementBuffer, PFNGLVERTEXARRAYELEMENTBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexArrayVertexBuffer, PFNGLVERTEXARRAYVERTEXBUFFERPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexArrayVertexBuffers, PFNGLVERTEXARRAYVERTEXBUFFERSPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexArrayAttribBinding, PFNGLVERTEXARRAYATTRIBBINDINGPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexArrayAttribFormat, PFNGLVERTEXARRAYATTRIBFORMATPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexArrayAttribIFormat, PFNGLVERTEXARRAYATTRIBIFORMATPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexArrayAttribLFormat, PFNGLVERTEXARRAYATTRIBLFORMATPROC)
+PS_HEADLESS_GL_FUNCTION(glVertexArrayBindingDivisor, PFNGLVERTEXARRAYBINDINGDIVISORPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexArrayiv, PFNGLGETVERTEXARRAYIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexArrayIndexediv, PFNGLGETVERTEXARRAYINDEXEDIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetVertexArrayIndexed64iv, PFNGLGETVERTEXARRAYINDEXED64IVPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateSamplers, PFNGLCREATESAMPLERSPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateProgramPipelines, PFNGLCREATEPROGRAMPIPELINESPROC)
+PS_HEADLESS_GL_FUNCTION(glCreateQueries, PFNGLCREATEQUERIESPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryBufferObjecti64v, PFNGLGETQUERYBUFFEROBJECTI64VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryBufferObjectiv, PFNGLGETQUERYBUFFEROBJECTIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryBufferObjectui64v, PFNGLGETQUERYBUFFEROBJECTUI64VPROC)
+PS_HEADLESS_GL_FUNCTION(glGetQueryBufferObjectuiv, PFNGLGETQUERYBUFFEROBJECTUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glMemoryBarrierByRegion, PFNGLMEMORYBARRIERBYREGIONPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTextureSubImage, PFNGLGETTEXTURESUBIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetCompressedTextureSubImage, PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetGraphicsResetStatus, PFNGLGETGRAPHICSRESETSTATUSPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnCompressedTexImage, PFNGLGETNCOMPRESSEDTEXIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnTexImage, PFNGLGETNTEXIMAGEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnUniformdv, PFNGLGETNUNIFORMDVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnUniformfv, PFNGLGETNUNIFORMFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnUniformiv, PFNGLGETNUNIFORMIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnUniformuiv, PFNGLGETNUNIFORMUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glReadnPixels, PFNGLREADNPIXELSPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnMapdv, PFNGLGETNMAPDVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnMapfv, PFNGLGETNMAPFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnMapiv, PFNGLGETNMAPIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnPixelMapfv, PFNGLGETNPIXELMAPFVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnPixelMapuiv, PFNGLGETNPIXELMAPUIVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnPixelMapusv, PFNGLGETNPIXELMAPUSVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnPolygonStipple, PFNGLGETNPOLYGONSTIPPLEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnColorTable, PFNGLGETNCOLORTABLEPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnConvolutionFilter, PFNGLGETNCONVOLUTIONFILTERPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnSeparableFilter, PFNGLGETNSEPARABLEFILTERPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnHistogram, PFNGLGETNHISTOGRAMPROC)
+PS_HEADLESS_GL_FUNCTION(glGetnMinmax, PFNGLGETNMINMAXPROC)
+PS_HEADLESS_GL_FUNCTION(glTextureBarrier, PFNGLTEXTUREBARRIERPROC)
+PS_HEADLESS_GL_FUNCTION(glSpecializeShader, PFNGLSPECIALIZESHADERPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiDrawArraysIndirectCount, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiDrawElementsIndirectCount, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)
+PS_HEADLESS_GL_FUNCTION(glPolygonOffsetClamp, PFNGLPOLYGONOFFSETCLAMPPROC)
+PS_HEADLESS_GL_FUNCTION(glClipPlanef, PFNGLCLIPPLANEFPROC)
+PS_HEADLESS_GL_FUNCTION(glFrustumf, PFNGLFRUSTUMFPROC)
+PS_HEADLESS_GL_FUNCTION(glGetClipPlanef, PFNGLGETCLIPPLANEFPROC)
+PS_HEADLESS_GL_FUNCTION(glOrthof, PFNGLORTHOFPROC)
+PS_HEADLESS_GL_FUNCTION(glAlphaFuncx, PFNGLALPHAFUNCXPROC)
+PS_HEADLESS_GL_FUNCTION(glClearColorx, PFNGLCLEARCOLORXPROC)
+PS_HEADLESS_GL_FUNCTION(glClearDepthx, PFNGLCLEARDEPTHXPROC)
+PS_HEADLESS_GL_FUNCTION(glClipPlanex, PFNGLCLIPPLANEXPROC)
+PS_HEADLESS_GL_FUNCTION(glColor4x, PFNGLCOLOR4XPROC)
+PS_HEADLESS_GL_FUNCTION(glDepthRangex, PFNGLDEPTHRANGEXPROC)
+PS_HEADLESS_GL_FUNCTION(glFogx, PFNGLFOGXPROC)
+PS_HEADLESS_GL_FUNCTION(glFogxv, PFNGLFOGXVPROC)
+PS_HEADLESS_GL_FUNCTION(glFrustumx, PFNGLFRUSTUMXPROC)
+PS_HEADLESS_GL_FUNCTION(glGetClipPlanex, PFNGLGETCLIPPLANEXPROC)
+PS_HEADLESS_GL_FUNCTION(glGetFixedv, PFNGLGETFIXEDVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetLightxv, PFNGLGETLIGHTXVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetMaterialxv, PFNGLGETMATERIALXVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexEnvxv, PFNGLGETTEXENVXVPROC)
+PS_HEADLESS_GL_FUNCTION(glGetTexParameterxv, PFNGLGETTEXPARAMETERXVPROC)
+PS_HEADLESS_GL_FUNCTION(glLightModelx, PFNGLLIGHTMODELXPROC)
+PS_HEADLESS_GL_FUNCTION(glLightModelxv, PFNGLLIGHTMODELXVPROC)
+PS_HEADLESS_GL_FUNCTION(glLightx, PFNGLLIGHTXPROC)
+PS_HEADLESS_GL_FUNCTION(glLightxv, PFNGLLIGHTXVPROC)
+PS_HEADLESS_GL_FUNCTION(glLineWidthx, PFNGLLINEWIDTHXPROC)
+PS_HEADLESS_GL_FUNCTION(glLoadMatrixx, PFNGLLOADMATRIXXPROC)
+PS_HEADLESS_GL_FUNCTION(glMaterialx, PFNGLMATERIALXPROC)
+PS_HEADLESS_GL_FUNCTION(glMaterialxv, PFNGLMATERIALXVPROC)
+PS_HEADLESS_GL_FUNCTION(glMultMatrixx, PFNGLMULTMATRIXXPROC)
+PS_HEADLESS_GL_FUNCTION(glMultiTexCoord4x, PFNGLMULTITEXCOORD4XPROC)
+PS_HEADLESS_GL_FUNCTION(glNormal3x, PFNGLNORMAL3XPROC)
+PS_HEADLESS_GL_FUNCTION(glOrthox, PFNGLORTHOXPROC)
+PS_HEADLESS_GL_FUNCTION(glPointParameterx, PFNGLPOINTPARAMETERXPROC)
+PS_HEADLESS_GL_FUNCTION(glPointParameterxv, PFNGLPOINTPARAMETERXVPROC)
+PS_HEADLESS_GL_FUNCTION(glPointSizex, PFNGLPOINTSIZEXPROC)
+PS_HEADLESS_GL_FUNCTION(glPolygonOffsetx, PFNGLPOLYGONOFFSETXPROC)
+PS_HEADLESS_GL_FUNCTION(glRotatex, PFNGLROTATEXPROC)
+PS_HEADLESS_GL_FUNCTION(glSampleCoveragex, PFNGLSAMPLECOVERAGEXPROC)
+PS_HEADLESS_GL_FUNCTION(glScalex, PFNGLSCALEXPROC)
+PS_HEADLESS_GL_FUNCTION(glTexEnvx, PFNGLTEXENVXPROC)
+PS_HEADLESS_GL_FUNCTION(glTexEnvxv, PFNGLTEXENVXVPROC)
+PS_HEADLESS_GL_FUNCTION(glTexParameterx, PFNGLTEXPARAMETERXPROC)
+PS_HEADLESS_GL_FUNCTION(glTexParameterxv, PFNGLTEXPARAMETERXVPROC)
+PS_HEADLESS_GL_FUNCTION(glTranslatex, PFNGLTRANSLATEXPROC)
+PS_HEADLESS_GL_FUNCTION(glBlendBarrier, PFNGLBLENDBARRIERPROC)
+PS_HEADLESS_GL_FUNCTION(glPrimitiveBoundingBox, PFNGLPRIMITIVEBOUNDINGBOXPROC)
@@ -0,0 +1,337 @@
+#include "pspch.h"
+#include "HeadlessWindow.h"
+
+#include <glad/glad.h>
+
+#include "PulseStudio/Log.h"
+#include "PulseStudio/Profiler.h"
+
+#include "PulseStudio/Events/ApplicationEvent.h"
+
+namespace PulseStudio {
+
+	// No-op GL: every glad entry point gets a stub with its exact prototype that ignores its
+	// arguments and returns a zero value, HeadlessGLFunctions.inl lists them all
+	template<typename Function>
+	struct NoOpGL;
+
+	template<typename Result, typename... Args>
+	struct NoOpGL<Result(APIENTRYP)(Args...)>
+	{
+		static Result APIENTRY Call(Args...)
+		{
+			return Result();
+		}
+	};
+
+	// glad needs a version string to decide which entry points to load
+	static const GLubyte* APIENTRY NoOpGetString(GLenum name)
+	{
+		static const char* s_Version = "4.6.0 Pulse Studio headless";
+		static const char* s_Empty = "";
+		return (const GLubyte*)(name == GL_VERSION ? s_Version : s_Empty);
+	}
+
+	// glad also lists the extensions and fails on a context that reports none
+	static void APIENTRY NoOpGetIntegerv(GLenum name, GLint* data)
+	{
+		if (data)
+			*data = name == GL_NUM_EXTENSIONS ? 1 : 0;
+	}
+
+	static const GLubyte* APIENTRY NoOpGetStringi(GLenum, GLuint)
+	{
+		return (const GLubyte*)"GL_PS_headless";
+	}
+
+	/*
+	* Buffers get real names and mapped ranges get scratch memory of their own, so uploads into
+	* persistently mapped buffers still pay for their copies. A mapping stays valid until the buffer
+	* is unmapped or deleted, like on a driver. Mapping a buffer that is already mapped fails.
+	*/
+	struct HeadlessBuffers
+	{
+		std::mutex Mutex;
+		GLuint NextName = 1;
+		std::unordered_map<GLenum, GLuint> Bindings;
+		std::unordered_map<GLuint, std::unique_ptr<std::byte[]>> Mappings;
+	};
+
+	static HeadlessBuffers& GetHeadlessBuffers()
+	{
+		static HeadlessBuffers s_Buffers;
+		return s_Buffers;
+	}
+
+	static void APIENTRY NoOpCreateBuffers(GLsizei count, GLuint* buffers)
+	{
+		HeadlessBuffers& state = GetHeadlessBuffers();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		for (GLsizei i = 0; i < count; i++)
+			buffers[i] = state.NextName++;
+	}
+
+	static void APIENTRY NoOpDeleteBuffers(GLsizei count, const GLuint* buffers)
+	{
+		HeadlessBuffers& state = GetHeadlessBuffers();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		for (GLsizei i = 0; i < count; i++)
+		{
+			state.Mappings.erase(buffers[i]);
+			std::erase_if(state.Bindings, [buffer = buffers[i]](const auto& binding) { return binding.second == buffer; });
+		}
+	}
+
+	static void APIENTRY NoOpBindBuffer(GLenum target, GLuint buffer)
+	{
+		HeadlessBuffers& state = GetHeadlessBuffers();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		state.Bindings[target] = buffer;
+	}
+
+	static void* MapHeadlessBuffer(HeadlessBuffers& state, GLuint buffer, GLsizeiptr length)
+	{
+		if (buffer == 0 || length <= 0 || state.Mappings.contains(buffer))
+			return nullptr;
+
+		auto& mapping = state.Mappings[buffer];
+		mapping = std::make_unique<std::byte[]>((size_t)length);
+		return mapping.get();
+	}
+
+	static void* APIENTRY NoOpMapNamedBufferRange(GLuint buffer, GLintptr, GLsizeiptr length, GLbitfield)
+	{
+		HeadlessBuffers& state = GetHeadlessBuffers();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		return MapHeadlessBuffer(state, buffer, length);
+	}
+
+	static void* APIENTRY NoOpMapBufferRange(GLenum target, GLintptr, GLsizeiptr length, GLbitfield)
+	{
+		HeadlessBuffers& state = GetHeadlessBuffers();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		auto binding = state.Bindings.find(target);
+		return binding != state.Bindings.end() ? MapHeadlessBuffer(state, binding->second, length) : nullptr;
+	}
+
+	static GLboolean APIENTRY NoOpUnmapNamedBuffer(GLuint buffer)
+	{
+		HeadlessBuffers& state = GetHeadlessBuffers();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		return state.Mappings.erase(buffer) > 0 ? GL_TRUE : GL_FALSE;
+	}
+
+	static GLboolean APIENTRY NoOpUnmapBuffer(GLenum target)
+	{
+		HeadlessBuffers& state = GetHeadlessBuffers();
+		std::lock_guard<std::mutex> lock(state.Mutex);
+		auto binding = state.Bindings.find(target);
+		return binding != state.Bindings.end() && state.Mappings.erase(binding->second) > 0 ? GL_TRUE : GL_FALSE;
+	}
+
+	static void* LoadNoOpGLFunction(const char* name)
+	{
+		static const std::unordered_map<std::string_view, void*> s_Functions = []()
+		{
+			std::unordered_map<std::string_view, void*> functions;
+#define PS_HEADLESS_GL_FUNCTION(name, type) functions[#name] = (void*)&NoOpGL<type>::Call;
+#include "HeadlessGLFunctions.inl"
+#undef PS_HEADLESS_GL_FUNCTION
+
+			// Stubs with behaviour, the cast to glad's pointer type checks their signatures
+#define PS_HEADLESS_GL_OVERRIDE(name, function) functions[#name] = (void*)static_cast<decltype(glad_##name)>(&function);
+			PS_HEADLESS_GL_OVERRIDE(glGetString, NoOpGetString)
+			PS_HEADLESS_GL_OVERRIDE(glGetStringi, NoOpGetStringi)
+			PS_HEADLESS_GL_OVERRIDE(glGetIntegerv, NoOpGetIntegerv)
+			PS_HEADLESS_GL_OVERRIDE(glCreateBuffers, NoOpCreateBuffers)
+			PS_HEADLESS_GL_OVERRIDE(glGenBuffers, NoOpCreateBuffers)
+			PS_HEADLESS_GL_OVERRIDE(glDeleteBuffers, NoOpDeleteBuffers)
+			PS_HEADLESS_GL_OVERRIDE(glBindBuffer, NoOpBindBuffer)
+			PS_HEADLESS_GL_OVERRIDE(glMapBufferRange, NoOpMapBufferRange)
+			PS_HEADLESS_GL_OVERRIDE(glMapNamedBufferRange, NoOpMapNamedBufferRange)
+			PS_HEADLESS_GL_OVERRIDE(glUnmapBuffer, NoOpUnmapBuffer)
+			PS_HEADLESS_GL_OVERRIDE(glUnmapNamedBuffer, NoOpUnmapNamedBuffer)
+#undef PS_HEADLESS_GL_OVERRIDE
+			return functions;
+		}();
+
+		auto function = s_Functions.find(name);
+		return function != s_Functions.end() ? function->second : nullptr;
+	}
+
+	HeadlessWindow::HeadlessWindow(const WindowProps& props)
+	{
+		Init(props);
+	}
+
+	HeadlessWindow::~HeadlessWindow()
+	{
+	}
+
+	void HeadlessWindow::Init(const WindowProps& props)
+	{
+		m_Data.Title = props.Title;
+		m_Data.Width = props.Width;
+		m_Data.Height = props.Height;
+		m_Data.VSync = false;
+
+		PS_CORE_INFO("Creating headless window {0} ({1}, {2})", props.Title, props.Width, props.Height);
+
+		int status = gladLoadGLLoader((GLADloadproc)LoadNoOpGLFunction);
+		PS_CORE_ASSERT(status, "Could not initialize the no-op GL loader!");
+
+		if (const char* frames = std::getenv("PS_HEADLESS_FRAMES"))
+			m_FrameLimit = std::strtoull(frames, nullptr, 10);
+
+		if (const char* script = std::getenv("PS_HEADLESS_EVENTS"))
+		{
+			if (LoadEventRecording(script, m_Script))
+				PS_CORE_INFO("Headless window replays {0} events from {1}", m_Script.size(), script);
+		}
+	}
+
+	void HeadlessWindow::WaitEvents(double timeout)
+	{
+		PS_PROFILE_FUNCTION();
+		QueueScriptedEvents();
+
+		{
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeout));
+
+			// Wake up early for the next scripted event
+			if (m_ScriptStarted && m_ScriptIndex < m_Script.size())
+				deadline = std::min(deadline, m_ScriptStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(m_Script[m_ScriptIndex].Time));
+
+			std::unique_lock<std::mutex> lock(m_EventMutex);
+			bool woken = m_EventCondition.wait_until(lock, deadline, [this]() { return !m_PendingEvents.empty() || m_WakeRequested; });
+			m_WakeRequested = false;
+
+			// An on-demand app that went idle with nothing left to replay draws no more frames,
+			// the frame limit would never be reached
+			if (!woken && m_FrameLimit > 0 && m_ScriptIndex == m_Script.size() && !m_CloseRequested)
+			{
+				PS_CORE_INFO("Headless window idle after {0} of {1} frames, closing.", m_FrameCount.load(), m_FrameLimit);
+				m_PendingEvents.push_back(WindowCloseEvent());
+				m_CloseRequested = true;
+			}
+		}
+
+		PollEvents();
+	}
+
+	void HeadlessWindow::WakeUp()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_EventMutex);
+			m_WakeRequested = true;
+		}
+		m_EventCondition.notify_one();
+	}
+
+	void HeadlessWindow::PollEvents()
+	{
+		PS_PROFILE_FUNCTION();
+		QueueScriptedEvents();
+		DeliverEvents();
+	}
+
+	void HeadlessWindow::SwapBuffers()
+	{
+		PS_PROFILE_FUNCTION();
+		uint64_t frame = ++m_FrameCount;
+		if (m_FrameLimit > 0 && frame == m_FrameLimit)
+		{
+			PS_CORE_INFO("Headless window presented {0} frames, closing.", frame);
+			PushEvent(WindowCloseEvent());
+		}
+	}
+
+	void HeadlessWindow::PushEvent(const EventValue& event)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_EventMutex);
+			m_PendingEvents.push_back(event);
+		}
+		m_EventCondition.notify_all();
+	}
+
+	void HeadlessWindow::QueueScriptedEvents()
+	{
+		if (m_Script.empty())
+			return;
+
+		auto now = std::chrono::steady_clock::now();
+		if (!m_ScriptStarted)
+		{
+			m_ScriptStart = now;
+			m_ScriptStarted = true;
+		}
+
+		std::lock_guard<std::mutex> lock(m_EventMutex);
+		while (m_ScriptIndex < m_Script.size() && m_ScriptStart + m_Script[m_ScriptIndex].Time <= now)
+			m_PendingEvents.push_back(m_Script[m_ScriptIndex++].Event);
+
+		if (m_ScriptIndex == m_Script.size() && m_FrameLimit == 0 && !m_CloseRequested)
+		{
+			m_PendingEvents.push_back(WindowCloseEvent());
+			m_CloseRequested = true;
+		}
+	}
+
+	void HeadlessWindow::DeliverEvents()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_EventMutex);
+			m_DeliveringEvents.swap(m_PendingEvents);
+		}
+
+		for (EventValue& event : m_DeliveringEvents)
+		{
+			if (event.GetEventType() == EventType::WindowResize)
+			{
+				const WindowResizeEvent& resize = *event.Get<WindowResizeEvent>();
+				m_Data.Width = resize.GetWidth();
+				m_Data.Height = resize.GetHeight();
+			}
+
+			if (m_Data.EventCallback)
+				m_Data.EventCallback(event.AsEvent());
+		}
+		m_DeliveringEvents.clear();
+	}
+
+	unsigned int HeadlessWindow::GetWidth() const
+	{
+		return m_Data.Width;
+	}
+
+	unsigned int HeadlessWindow::GetHeight() const
+	{
+		return m_Data.Height;
+	}
+
+	void HeadlessWindow::SetEventCallback(const EventCallbackFn& callback)
+	{
+		m_Data.EventCallback = callback;
+	}
+
+	void HeadlessWindow::SetVSync(bool enabled)
+	{
+		m_Data.VSync = enabled;
+	}
+
+	bool HeadlessWindow::IsVSync() const
+	{
+		return m_Data.VSync;
+	}
+
+	void HeadlessWindow::SetContextCurrent(bool)
+	{
+	}
+
+	void* HeadlessWindow::GetNativeWindow() const
+	{
+		return nullptr;
+	}
+
+}
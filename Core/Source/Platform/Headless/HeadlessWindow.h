@@ -0,0 +1,82 @@
+#pragma once
+#include "PulseStudio/Window.h"
+#include "PulseStudio/Events/EventRecording.h"
+
+#include <condition_variable>
+
+namespace PulseStudio {
+
+	/*
+	* Window without a display for benchmarks and CI. GL entry points are bound to no-op stubs, so the
+	* whole frame (layers, command recording, render thread) runs without a GPU and only the driver
+	* work is missing. Events come from PushEvent() or from an event recording replayed at its
+	* original timing; both are delivered through the event callback when the window is polled.
+	*
+	* Environment:
+	*   PS_HEADLESS=1                 select this backend even where a real one exists
+	*   PS_HEADLESS_EVENTS=<file>     replay an EventRecorder file, then close the window
+	*   PS_HEADLESS_FRAMES=<count>    close the window after this many presented frames, or when the
+	*                                 app goes idle before that
+	*/
+	class HeadlessWindow : public Window
+	{
+	public:
+		using EventCallbackFn = std::function<void(Event&)>;
+
+		HeadlessWindow(const WindowProps& props);
+		virtual ~HeadlessWindow();
+
+		void WaitEvents(double timeout) override;
+		void WakeUp() override;
+		void PollEvents() override;
+		void SwapBuffers() override;
+
+		// Window attributes
+		void SetEventCallback(const EventCallbackFn& callback) override;
+		void SetVSync(bool enabled) override;
+		bool IsVSync() const override;
+
+		void SetContextCurrent(bool current) override;
+
+		unsigned int GetWidth() const override;
+		unsigned int GetHeight() const override;
+
+		void* GetNativeWindow() const override;
+
+		// Queue a synthetic event for the next poll, callable from any thread
+		void PushEvent(const EventValue& event);
+
+		inline uint64_t GetFrameCount() const { return m_FrameCount; }
+	private:
+		void Init(const WindowProps& props);
+		void QueueScriptedEvents();
+		void DeliverEvents();
+
+		struct WindowData
+		{
+			std::string Title;
+			unsigned int Width, Height;
+			bool VSync;
+
+			EventCallbackFn EventCallback;
+		};
+
+		WindowData m_Data;
+
+		std::mutex m_EventMutex;
+		std::condition_variable m_EventCondition;
+		std::vector<EventValue> m_PendingEvents;
+		std::vector<EventValue> m_DeliveringEvents;
+		bool m_WakeRequested = false;
+
+		std::vector<RecordedEvent> m_Script;
+		size_t m_ScriptIndex = 0;
+		std::chrono::steady_clock::time_point m_ScriptStart;
+		bool m_ScriptStarted = false;
+
+		uint64_t m_FrameLimit = 0;
+		std::atomic<uint64_t> m_FrameCount = 0;
+		bool m_CloseRequested = false;
+	};
+
+}
@@ -5,6 +5,7 @@
 #include <glad/glad.h>
 
 #include "PulseStudio/Log.h"
+#include "PulseStudio/Profiler.h"
 
 #include "PulseStudio/Events/ApplicationEvent.h"
 #include "PulseStudio/Events/KeyEvent.h"
@@ -16,7 +17,7 @@ namespace PulseStudio {
 
     static void GLFWErrorCallback(int error, const char* description)
     {
-        PS_CORE_ERROR(std::format("GLFW Error ({0}): {1}", error, description));
+        PS_CORE_ERROR("GLFW Error ({0}): {1}", error, description);
     }
 
     WindowsWindow::WindowsWindow(const WindowProps& props)
@@ -30,7 +31,7 @@ namespace PulseStudio {
         m_Data.Width = props.Width;
         m_Data.Height = props.Height;
 
-        PS_CORE_INFO(std::format("Creating window {0} ({1}, {2})", props.Title, props.Width, props.Height));
+        PS_CORE_INFO("Creating window {0} ({1}, {2})", props.Title, props.Width, props.Height);
 
         if (!s_GLFWInitialized)
         {
@@ -146,12 +147,29 @@ namespace PulseStudio {
             });
     }
 
-    void WindowsWindow::OnUpdate()
+    void WindowsWindow::PollEvents()
     {
+        PS_PROFILE_FUNCTION();
         glfwPollEvents();
+    }
+
+    void WindowsWindow::SwapBuffers()
+    {
+        PS_PROFILE_FUNCTION();
         glfwSwapBuffers(m_Window);
     }
 
+    void WindowsWindow::WaitEvents(double timeout)
+    {
+        PS_PROFILE_FUNCTION();
+        glfwWaitEventsTimeout(timeout);
+    }
+
+    void WindowsWindow::WakeUp()
+    {
+        glfwPostEmptyEvent();
+    }
+
     WindowsWindow::~WindowsWindow()
     {
         glfwDestroyWindow(m_Window);
@@ -184,6 +202,11 @@ namespace PulseStudio {
         return m_Data.VSync;
     }
 
+    void WindowsWindow::SetContextCurrent(bool current)
+    {
+        glfwMakeContextCurrent(current ? m_Window : nullptr);
+    }
+
     void* WindowsWindow::GetNativeWindow() const
     {
         return m_Window;
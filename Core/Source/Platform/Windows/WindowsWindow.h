@@ -16,13 +16,18 @@ namespace PulseStudio {
 		void Shutdown();
 		void Init(const WindowProps& props);
 
-		void OnUpdate() override;
+		void WaitEvents(double timeout) override;
+		void WakeUp() override;
+		void PollEvents() override;
+		void SwapBuffers() override;
 
 		// Window attributes
 		void SetEventCallback(const EventCallbackFn& callback) override;
 		void SetVSync(bool enabled) override;
 		bool IsVSync() const override;
 
+		void SetContextCurrent(bool current) override;
+
 		unsigned int GetWidth() const override;
 		unsigned int GetHeight() const override;
 
@@ -4,6 +4,19 @@
 #include "PulseStudio/Layer.h"
 #include "PulseStudio/Log.h"
 #include "PulseStudio/Input.h"
+#include "PulseStudio/Profiler.h"
+#include "PulseStudio/Jobs/JobSystem.h"
+#include "PulseStudio/Memory/Memory.h"
+#include "PulseStudio/Memory/MemoryResource.h"
+#include "PulseStudio/Memory/PoolAllocator.h"
+#include "PulseStudio/Memory/AllocationTracker.h"
+#include "PulseStudio/Renderer/Renderer2D.h"
+#include "PulseStudio/Text/Font.h"
+#include "PulseStudio/Text/GlyphAtlas.h"
+#include "PulseStudio/Text/GlyphCache.h"
+#include "PulseStudio/Text/TextLayout.h"
+#include "PulseStudio/Text/TextRenderer.h"
+#include "PulseStudio/Text/Utf8.h"
 
 // Codes
 #include "PulseStudio/KeyCodes.h"
@@ -2,12 +2,17 @@
 
 #include "Application.h"
 #include "Events/ApplicationEvent.h"
+#include "Events/EventTrace.h"
 #include "Log.h"
 #include "Window.h"
 
 #include <glad/glad.h>
 
 #include "Input.h"
+#include "Profiler.h"
+#include "Jobs/JobSystem.h"
+#include "Memory/Memory.h"
+#include "Renderer/Renderer2D.h"
 
 namespace PulseStudio {
 
@@ -15,6 +20,9 @@ namespace PulseStudio {
 
 	Application* Application::s_Instance = nullptr;
 
+    // Longest an idle OnDemand loop sleeps before checking for work again, in seconds
+    static constexpr double s_IdleWaitTimeout = 0.5;
+
     bool createDirectoryIfNotExists(const std::string& path)
     {
         namespace fs = std::filesystem;
@@ -42,94 +50,291 @@ namespace PulseStudio {
         // Initialize the logger in the constructor
         if (createDirectoryIfNotExists("Logs"))
         {
-            Logger::getInstance().init("Logs/PulseStudioLog.log", LogLevel::Debug, LogLevel::Debug);
+            // Rotate the log every 8 MB or 24 hours and keep the last 10 segments
+            LogRotationSettings rotation;
+            rotation.segmentSize = 8 * 1024 * 1024;
+            rotation.maxAge = std::chrono::hours(24);
+            rotation.maxSegments = 10;
+            Logger::getInstance().init("Logs/PulseStudioLog.log", LogLevel::Debug, LogLevel::Debug, rotation);
+
+            // Keep formatting and file I/O off the UI thread
+            Logger::getInstance().enableAsync(8192, LogOverflowPolicy::DropAndCount);
         }
         LOG_INFO("Application constructor called.");
 
         WindowProps props("Pulse Studio", 1700, 1000);
         m_MainWindow = std::unique_ptr<Window>(Window::Create(props));
-		m_MainWindow->SetEventCallback(BIND_EVENT_FN(OnEvent));
+        if (m_MainWindow)
+            m_MainWindow->SetEventCallback(BIND_EVENT_FN(QueueEvent));
 
         Input::Init();
+        EventTrace::Init();
+
+        JobSystem::Init();
+        if (m_MainWindow)
+            JobSystem::SetMainThreadWakeCallback([window = m_MainWindow.get()]() { window->WakeUp(); });
     }
 
     Application::~Application()
     {
         LOG_INFO("Application destructor called.");
 		LOG_CORE_DEBUG("Shutting down Pulse Studio...");
+        StopEventRecording();
+        // Workers may still post to the window or the log
+        JobSystem::Shutdown();
         // Shutdown the logger when the application is destroyed
         Logger::getInstance().shutdown();
     }
 
+    bool Application::StartEventRecording(const std::string& path)
+    {
+        return m_EventRecorder.Start(path);
+    }
+
+    void Application::StopEventRecording()
+    {
+        m_EventRecorder.Stop();
+    }
+
+    ReplayStats Application::ReplayEvents(const std::string& path, ReplayTiming timing)
+    {
+        std::vector<RecordedEvent> events;
+        if (!LoadEventRecording(path, events))
+            return ReplayStats();
+
+        PS_CORE_INFO("Replaying {0} events from {1}", events.size(), path);
+        ReplayStats stats = EventReplay::Run(events, timing, [this](EventValue& e) { OnEvent(e); });
+        EventReplay::LogStats(stats);
+        return stats;
+    }
+
+    void Application::SetTargetFrameRate(uint32_t framesPerSecond)
+    {
+        m_FramePacer.SetTargetRate(framesPerSecond);
+        if (!m_MainWindow)
+            return;
+
+        // The swap interval belongs to the context, set it wherever the context lives
+        bool vsync = framesPerSecond != 0;
+        if (m_RenderThread.IsRunning())
+            m_RenderThread.SubmitOnce([window = m_MainWindow.get(), vsync]() { window->SetVSync(vsync); });
+        else
+            m_MainWindow->SetVSync(vsync);
+    }
+
+    void Application::SetRenderMode(RenderMode mode)
+    {
+        m_RenderMode = mode;
+        Invalidate();
+    }
+
+    void Application::Invalidate()
+    {
+        m_Damage.AddAll();
+    }
+
+    void Application::InvalidateRect(const Rect& rect)
+    {
+        m_Damage.Add(rect);
+    }
+
     void Application::PushLayer(Layer* layer)
     {
+        PS_MEMORY_TAG(Layers);
         m_LayerStack.PushLayer(layer);
         layer->OnAttach();
 	}
 
     void Application::PushOverlay(Layer* overlay)
     {
+        PS_MEMORY_TAG(Layers);
         m_LayerStack.PushOverlay(overlay);
 		overlay->OnAttach();
 	}
 
     void Application::OnEvent(Event& e)
     {
-		LOG_CORE_INFO(e.ToString());
-        EventDispatcher dispatcher(e);
+        std::optional<EventValue> value = EventValue::From(e);
+        if (!value)
+        {
+            PS_CORE_WARN("Unsupported event {0} ignored.", e.GetName());
+            return;
+        }
+
+        OnEvent(*value);
+        e.m_Handled = value->IsHandled();
+	}
+
+    void Application::OnEvent(EventValue& value)
+    {
+        PS_PROFILE_FUNCTION();
+
+        EventTrace::Record(value);
+        Input::OnEvent(value);
+        if (m_EventRecorder.IsRecording())
+            m_EventRecorder.Record(value);
+
+        Event& e = value.AsEvent();
+        EventDispatcher dispatcher = value.GetDispatcher();
         dispatcher.Dispatch<WindowCloseEvent>(std::bind(&Application::OnWindowClose, this, std::placeholders::_1));
-        for (auto it = m_LayerStack.end(); it != m_LayerStack.begin(); )
+        dispatcher.Dispatch<WindowResizeEvent>(std::bind(&Application::OnWindowResize, this, std::placeholders::_1));
+
+        PS_MEMORY_TAG(Layers);
+        for (Layer* layer : m_LayerStack.GetDispatchList(value.GetEventType()))
         {
-            (*--it)->OnEvent(e);
+            PS_PROFILE_SCOPE_DYNAMIC(layer->GetName());
+            layer->OnEvent(e);
             if (e.m_Handled)
                 break;
         }
 	}
 
+    void Application::QueueEvent(Event& e)
+    {
+        // Let the render thread repaint at the new size even while this thread is stuck in the
+        // OS resize loop and cannot dispatch
+        if (e.GetEventType() == EventType::WindowResize)
+        {
+            WindowResizeEvent& resize = static_cast<WindowResizeEvent&>(e);
+            m_RenderThread.NotifyResize(resize.GetWidth(), resize.GetHeight());
+        }
+
+        m_EventBus.Enqueue(e);
+    }
+
     void Application::Run()
     {
         LOG_TRACE("Pulse Studio initialized and running.");
 
-        // Draw a Titlebar with a close button in the top right corner
-        float vertices[] =
+        if (!m_MainWindow)
         {
-            // positions         // colors
-             0.9f,  0.9f, 0.0f,  1.0f, 0.0f, 0.0f, // top right
-             0.8f,  0.9f, 0.0f,  1.0f, 0.0f, 0.0f, // top left
-             0.8f,  0.8f, 0.0f,  1.0f, 0.0f, 0.0f, // bottom left
-             0.9f,  0.8f, 0.0f,  1.0f, 0.0f, 0.0f  // bottom right
-        };
+            PS_CORE_ERROR("Main window is null!");
+            return;
+        }
+
+        Profiler::SetThreadName("Main");
+
+        // Layers record GL work, the render thread executes and presents it
+        m_RenderThread.Start(m_MainWindow.get(), m_RenderThreadMode);
+        Renderer2D::Init(m_RenderThread);
+
+        // Nothing has been drawn yet
+        Invalidate();
+
+        // Frame memory of the last submitted frame must outlive idle iterations, the render
+        // thread replays that frame on resize
+        bool frameSubmitted = true;
 
         do 
         {
-            glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT);
-            
-            glEnableClientState(GL_VERTEX_ARRAY);
-            glVertexPointer(2, GL_FLOAT, 0, vertices);
-            glDrawArrays(GL_TRIANGLES, 0, 6);
-            glDisableClientState(GL_VERTEX_ARRAY);
-
-            for (Layer* layer : m_LayerStack)
-                if (layer)
-                    layer->OnUpdate(0.0f);
-
-            if (m_MainWindow)
+            float deltaTime = m_FramePacer.BeginFrame();
+            Profiler::BeginFrame();
+            if (frameSubmitted)
+                Memory::BeginFrame();
+            frameSubmitted = false;
+            Input::BeginFrame();
+
+            // Deliver everything the window queued since the last frame
+            {
+                PS_PROFILE_SCOPE("EventBus::Dispatch");
+                m_EventBus.Dispatch([this](EventValue& e) { OnEvent(e); });
+            }
+
+            // Apply results background jobs handed back to the main thread
+            JobSystem::DrainMainThreadQueue();
+
+            if (m_RenderMode == RenderMode::Continuous)
+                m_Damage.AddAll();
+
+            if (m_Damage.IsEmpty())
+            {
+                // Idle: nothing to draw and no events pending, sleep until the OS has input for us
+                EventTrace::EndFrame();
+                Profiler::EndFrame();
+                m_MainWindow->WaitEvents(s_IdleWaitTimeout);
+                continue;
+            }
+
+            // The back buffer still holds the frame before last, so repaint what changed in
+            // either frame. Damage added while drawing is picked up by the next frame.
+            DamageRegion damage = m_Damage;
+            damage.Merge(m_PreviousDamage);
+            m_PreviousDamage = m_Damage;
+            m_Damage.Clear();
+
+            int width = (int)m_MainWindow->GetWidth();
+            int height = (int)m_MainWindow->GetHeight();
+            Rect bounds = damage.GetBounds(width, height);
+            bool scissor = !damage.IsFull();
+
+            // A resize repaint replays this frame at a size the rect was not computed for, it
+            // clears and draws the whole window instead
+            RenderThread* renderThread = &m_RenderThread;
+            m_RenderThread.Submit([renderThread, scissor, bounds, height]()
+                {
+                    if (scissor && !renderThread->IsRepainting())
+                    {
+                        glEnable(GL_SCISSOR_TEST);
+                        glScissor(bounds.X, height - (bounds.Y + bounds.Height), bounds.Width, bounds.Height);
+                    }
+
+                    glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+                    glClear(GL_COLOR_BUFFER_BIT);
+                });
+
+            Renderer2D::BeginFrame((uint32_t)width, (uint32_t)height);
+
+            // Close button in the top right corner of the title bar
+            Renderer2D::DrawQuad({ width * 0.9f, height * 0.05f }, { width * 0.05f, height * 0.05f }, { 1.0f, 0.0f, 0.0f, 1.0f });
+
+            {
+                PS_PROFILE_SCOPE("LayerStack::OnUpdate");
+                PS_MEMORY_TAG(Layers);
+                for (Layer* layer : m_LayerStack)
+                {
+                    if (!layer)
+                        continue;
+
+                    PS_PROFILE_SCOPE_DYNAMIC(layer->GetName());
+                    layer->OnUpdate(deltaTime);
+                }
+            }
+
+            Renderer2D::EndFrame();
+
+            if (scissor)
+                m_RenderThread.Submit([]() { glDisable(GL_SCISSOR_TEST); });
+
+            EventTrace::EndFrame();
+
             {
-                m_MainWindow->OnUpdate();
+                PS_PROFILE_SCOPE("RenderThread::EndFrame");
+                m_RenderThread.EndFrame();
             }
-            else
+            frameSubmitted = true;
+
+            // Use up the rest of the frame budget before polling, so the events collected
+            // are dispatched right away by the next frame
             {
-                PS_CORE_ERROR("Main window is null!");
-                m_Running = false;
+                PS_PROFILE_SCOPE("FramePacer::Wait");
+                m_FramePacer.Wait();
             }
 
-			// Add a small sleep to prevent high CPU usage
-            std::this_thread::sleep_for(std::chrono::milliseconds(16));
+            m_MainWindow->PollEvents();
+            Profiler::EndFrame();
         } while (m_Running);
+
+        m_RenderThread.Stop();
+        Renderer2D::Shutdown();
+    }
+
+    bool Application::OnWindowResize(WindowResizeEvent&)
+    {
+        m_Damage.AddAll();
+        return false;
     }
 
-    bool Application::OnWindowClose(WindowCloseEvent& e) 
+    bool Application::OnWindowClose(WindowCloseEvent&) 
     {
 		LOG_WARN("Window close event received. Shutting down Application...");
         m_Running = false;
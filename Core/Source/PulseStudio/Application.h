@@ -2,11 +2,23 @@
 
 #include "Events/Event.h"
 #include "Events/ApplicationEvent.h"
+#include "Events/EventBus.h"
+#include "Events/EventRecording.h"
+#include "Events/EventReplay.h"
 #include "Window.h"
 #include "LayerStack.h"
+#include "FramePacer.h"
+#include "DamageRegion.h"
+#include "Renderer/RenderThread.h"
 
 namespace PulseStudio {
 
+	enum class RenderMode
+	{
+		Continuous = 0,	// Redraw the whole window every frame
+		OnDemand		// Redraw only damaged regions, sleep in the event loop while nothing is damaged
+	};
+
 	class Application
 	{
 	public:
@@ -16,6 +28,32 @@ namespace PulseStudio {
 		void Run();
 
 		void OnEvent(Event& e);
+		void OnEvent(EventValue& e);
+
+		// Queue an event for dispatch at the start of the next frame
+		void QueueEvent(Event& e);
+
+		// Record every dispatched event to a file for later replay
+		bool StartEventRecording(const std::string& path);
+		void StopEventRecording();
+
+		// Feed a recording through OnEvent and the layer stack, the window is not involved
+		ReplayStats ReplayEvents(const std::string& path, ReplayTiming timing = ReplayTiming::AsFastAsPossible);
+
+		// Frames per second for the main loop, 0 runs uncapped (VSync off) for benchmarks
+		void SetTargetFrameRate(uint32_t framesPerSecond);
+		inline uint32_t GetTargetFrameRate() const { return m_FramePacer.GetTargetRate(); }
+
+		void SetRenderMode(RenderMode mode);
+		inline RenderMode GetRenderMode() const { return m_RenderMode; }
+
+		// Threaded by default, takes effect the next time Run() starts
+		inline void SetRenderThreadMode(RenderThreadMode mode) { m_RenderThreadMode = mode; }
+		inline RenderThread& GetRenderThread() { return m_RenderThread; }
+
+		// Schedule a redraw of the whole window or of a region (window coordinates, origin top left)
+		void Invalidate();
+		void InvalidateRect(const Rect& rect);
 
 		void PushLayer(class Layer* layer);
 		void PushOverlay(class Layer* overlay);
@@ -24,10 +62,19 @@ namespace PulseStudio {
 		inline Window& GetWindow() { return *m_MainWindow; }
 	private:
 		bool OnWindowClose(WindowCloseEvent& e);
+		bool OnWindowResize(WindowResizeEvent& e);
 
 		std::unique_ptr<class Window> m_MainWindow;
 		bool m_Running = true;
 		LayerStack m_LayerStack;
+		EventBus m_EventBus;
+		EventRecorder m_EventRecorder;
+		FramePacer m_FramePacer;
+		RenderMode m_RenderMode = RenderMode::Continuous;
+		DamageRegion m_Damage;
+		DamageRegion m_PreviousDamage;
+		RenderThread m_RenderThread;
+		RenderThreadMode m_RenderThreadMode = RenderThreadMode::Threaded;
 		static Application* s_Instance;
 	};
 
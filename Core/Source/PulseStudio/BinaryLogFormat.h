@@ -0,0 +1,158 @@
+#pragma once
+
+// On-disk layout of the binary log sink, shared by Logger and the LogDecode tool.
+// Kept free of Core dependencies so tools can include it on its own.
+//
+// File   := Header Record*
+// Header := magic[8] version:u16 ticksPerSecond:u64
+// Record := kind:u8 ...
+//   FormatDef := formatId:varint length:varint bytes         (once per format string)
+//   Entry     := level:u8 formatId:varint tickDelta:zigzag threadId:varint argCount:u8 Arg*
+//   Arg       := type:u8 value
+//
+// Integers are LEB128 varints (signed ones zigzag encoded), doubles are raw
+// little-endian 8 bytes, strings are length:varint + bytes. Tick deltas are
+// relative to the previous entry, the first entry is relative to zero.
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace BinaryLog {
+
+    constexpr char s_Magic[8] = { 'P', 'S', 'B', 'L', 'O', 'G', '\r', '\n' };
+    constexpr uint16_t s_Version = 1;
+    constexpr size_t s_HeaderSize = sizeof(s_Magic) + sizeof(uint16_t) + sizeof(uint64_t);
+
+    // Format id 0 is reserved for prebuilt messages, stored as a single string argument
+    constexpr uint32_t s_MessageFormatId = 0;
+    constexpr std::string_view s_MessageFormat = "{0}";
+
+    enum class RecordKind : uint8_t
+    {
+        FormatDef = 1,
+        Entry = 2
+    };
+
+    enum class ArgType : uint8_t
+    {
+        Bool = 1,
+        Char,
+        Int,
+        UInt,
+        Double,
+        String,
+        Pointer
+    };
+
+    inline void WriteVarint(std::string& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out += static_cast<char>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        out += static_cast<char>(value);
+    }
+
+    inline void WriteZigzag(std::string& out, int64_t value)
+    {
+        WriteVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    inline void WriteRaw(std::string& out, const void* data, size_t size)
+    {
+        out.append(static_cast<const char*>(data), size);
+    }
+
+    inline void WriteString(std::string& out, std::string_view value)
+    {
+        WriteVarint(out, value.size());
+        out.append(value.data(), value.size());
+    }
+
+    inline void WriteHeader(std::string& out, uint64_t ticksPerSecond)
+    {
+        WriteRaw(out, s_Magic, sizeof(s_Magic));
+        WriteRaw(out, &s_Version, sizeof(s_Version));
+        WriteRaw(out, &ticksPerSecond, sizeof(ticksPerSecond));
+    }
+
+    // Sequential reader over a byte range, every Read* returns false on truncated input
+    class Reader
+    {
+    public:
+        Reader(const char* data, size_t size)
+            : m_Data(data), m_Size(size)
+        {
+        }
+
+        bool AtEnd() const { return m_Offset >= m_Size; }
+        size_t GetOffset() const { return m_Offset; }
+
+        bool ReadRaw(void* destination, size_t size)
+        {
+            if (m_Size - m_Offset < size)
+                return false;
+            std::memcpy(destination, m_Data + m_Offset, size);
+            m_Offset += size;
+            return true;
+        }
+
+        bool ReadByte(uint8_t& value)
+        {
+            return ReadRaw(&value, 1);
+        }
+
+        bool ReadVarint(uint64_t& value)
+        {
+            value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                uint8_t byte;
+                if (!ReadByte(byte))
+                    return false;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80))
+                    return true;
+            }
+            return false;
+        }
+
+        bool ReadZigzag(int64_t& value)
+        {
+            uint64_t raw;
+            if (!ReadVarint(raw))
+                return false;
+            value = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+            return true;
+        }
+
+        bool ReadString(std::string& value)
+        {
+            uint64_t size;
+            if (!ReadVarint(size) || m_Size - m_Offset < size)
+                return false;
+            value.assign(m_Data + m_Offset, static_cast<size_t>(size));
+            m_Offset += static_cast<size_t>(size);
+            return true;
+        }
+
+        bool ReadHeader(uint64_t& ticksPerSecond)
+        {
+            char magic[sizeof(s_Magic)];
+            uint16_t version;
+            if (!ReadRaw(magic, sizeof(magic)) || std::memcmp(magic, s_Magic, sizeof(s_Magic)) != 0)
+                return false;
+            if (!ReadRaw(&version, sizeof(version)) || version != s_Version)
+                return false;
+            return ReadRaw(&ticksPerSecond, sizeof(ticksPerSecond));
+        }
+    private:
+        const char* m_Data;
+        size_t m_Size;
+        size_t m_Offset = 0;
+    };
+
+}
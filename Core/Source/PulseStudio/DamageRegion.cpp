@@ -0,0 +1,50 @@
+#include "pspch.h"
+#include "DamageRegion.h"
+
+namespace PulseStudio {
+
+	Rect Rect::Union(const Rect& other) const
+	{
+		if (IsEmpty())
+			return other;
+		if (other.IsEmpty())
+			return *this;
+
+		int left = std::min(X, other.X);
+		int top = std::min(Y, other.Y);
+		int right = std::max(X + Width, other.X + other.Width);
+		int bottom = std::max(Y + Height, other.Y + other.Height);
+		return { left, top, right - left, bottom - top };
+	}
+
+	Rect Rect::Intersect(const Rect& other) const
+	{
+		int left = std::max(X, other.X);
+		int top = std::max(Y, other.Y);
+		int right = std::min(X + Width, other.X + other.Width);
+		int bottom = std::min(Y + Height, other.Y + other.Height);
+		if (right <= left || bottom <= top)
+			return Rect();
+		return { left, top, right - left, bottom - top };
+	}
+
+	void DamageRegion::Add(const Rect& rect)
+	{
+		if (!m_Full)
+			m_Bounds = m_Bounds.Union(rect);
+	}
+
+	void DamageRegion::Merge(const DamageRegion& other)
+	{
+		m_Full = m_Full || other.m_Full;
+		if (!m_Full)
+			m_Bounds = m_Bounds.Union(other.m_Bounds);
+	}
+
+	Rect DamageRegion::GetBounds(int windowWidth, int windowHeight) const
+	{
+		Rect window = { 0, 0, windowWidth, windowHeight };
+		return m_Full ? window : m_Bounds.Intersect(window);
+	}
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "pspch.h"
+
+namespace PulseStudio {
+
+	// Axis-aligned rectangle in window coordinates, origin at the top left
+	struct Rect
+	{
+		int X = 0, Y = 0;
+		int Width = 0, Height = 0;
+
+		inline bool IsEmpty() const { return Width <= 0 || Height <= 0; }
+
+		Rect Union(const Rect& other) const;
+		Rect Intersect(const Rect& other) const;
+	};
+
+	/*
+	* Area of the window that has to be redrawn. Damaged rectangles are merged into their bounding
+	* box so a frame needs a single scissor rect and a single pass; a few scattered rects still cost
+	* far less than the whole window. AddAll() marks everything, e.g. after a resize.
+	*/
+	class DamageRegion
+	{
+	public:
+		void Add(const Rect& rect);
+		void AddAll() { m_Full = true; }
+		void Merge(const DamageRegion& other);
+		void Clear() { m_Bounds = Rect(); m_Full = false; }
+
+		inline bool IsEmpty() const { return !m_Full && m_Bounds.IsEmpty(); }
+		inline bool IsFull() const { return m_Full; }
+
+		// Bounding box of the damage, clipped to a window of the given size
+		Rect GetBounds(int windowWidth, int windowHeight) const;
+	private:
+		Rect m_Bounds;
+		bool m_Full = false;
+	};
+
+}
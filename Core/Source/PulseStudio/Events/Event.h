@@ -6,8 +6,8 @@
 namespace PulseStudio {
 
 	/*
-	* Events in Pulse Studio are currently blocking, meaning when an event occurs it immediately gets dispatched and must be dealt with right then and there.
-	* For the future, a better strategy might be to buffer events in an event bus and process them during the "event" part of the update stage.
+	* Events in Pulse Studio are buffered: platform callbacks queue them in the EventBus (see EventBus.h)
+	* and the application dispatches them once per frame during the "event" part of the update stage.
 	*/
 	
 	enum class EventType
@@ -19,6 +19,8 @@ namespace PulseStudio {
 		MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseScrolled
 	};
 
+	constexpr size_t EventTypeCount = (size_t)EventType::MouseScrolled + 1;
+
 	enum EventCategory
 	{
 		None = 0,
@@ -26,13 +28,18 @@ namespace PulseStudio {
 		EventCategoryInput			= BIT(1),
 		EventCategoryKeyboard		= BIT(2),
 		EventCategoryMouse			= BIT(3),
-		EventCategoryMouseButton	= BIT(4)
+		EventCategoryMouseButton	= BIT(4),
+		EventCategoryAll			= EventCategoryApplication | EventCategoryInput | EventCategoryKeyboard | EventCategoryMouse | EventCategoryMouseButton
 	};
 
-#define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::##type; }\
+	// Static accessors let value-type code (EventValue, EventDispatcher) query type and
+	// categories at compile time, the virtual ones keep the polymorphic API working
+#define EVENT_CLASS_TYPE(type) static constexpr EventType GetStaticType() { return EventType::type; }\
+								static constexpr const char* GetStaticName() { return #type; }\
 								virtual EventType GetEventType() const override { return GetStaticType(); }\
-								virtual const char* GetName() const override { return #type; }
-#define EVENT_CLASS_CATEGORY(category) virtual int GetCategoryFlags() const override { return category; }
+								virtual const char* GetName() const override { return GetStaticName(); }
+#define EVENT_CLASS_CATEGORY(category) static constexpr int GetStaticCategoryFlags() { return category; }\
+								virtual int GetCategoryFlags() const override { return GetStaticCategoryFlags(); }
 
 	class Event
 	{
@@ -51,14 +58,19 @@ namespace PulseStudio {
 	class EventDispatcher
 	{
 	public:
+		// The type is read once here, every Dispatch<T> is then a plain compare
 		EventDispatcher(Event& event)
-			: m_Event(event)
+			: m_Event(event), m_Type(event.GetEventType())
+		{
+		}
+		EventDispatcher(Event& event, EventType type)
+			: m_Event(event), m_Type(type)
 		{
 		}
 		template<typename T, typename F>
 		bool Dispatch(const F& func)
 		{
-			if (m_Event.GetEventType() == T::GetStaticType())
+			if (m_Type == T::GetStaticType())
 			{
 				m_Event.m_Handled = func(static_cast<T&>(m_Event));
 				return true;
@@ -67,6 +79,7 @@ namespace PulseStudio {
 		}
 	private:
 		Event& m_Event;
+		EventType m_Type;
 	};
 
 	inline std::ostream& operator<<(std::ostream& os, const Event& e)
@@ -0,0 +1,96 @@
+#include "pspch.h"
+#include "EventBus.h"
+
+namespace PulseStudio {
+
+	// EventValue owns nothing, so the arena is reset without destroying the events in it
+	static_assert(std::is_trivially_destructible_v<EventValue>, "Queued events are never destroyed");
+
+	EventBus::EventBus(size_t blockSize)
+		: m_Arena(blockSize)
+	{
+	}
+
+	void EventBus::Enqueue(const Event& event)
+	{
+		std::optional<EventValue> value = EventValue::From(event);
+		if (!value)
+		{
+			PS_CORE_WARN("EventBus cannot queue event {0}, dropping it.", event.GetName());
+			return;
+		}
+
+		Enqueue(*value);
+	}
+
+	void EventBus::Enqueue(const EventValue& event)
+	{
+		PS_MEMORY_TAG(Events);
+		if (TryCoalesce(event))
+		{
+			m_CoalescedCount++;
+			return;
+		}
+
+		if (m_Count == m_Chunks.size() * ChunkSize)
+			m_Chunks.push_back(static_cast<EventValue*>(m_Arena.Allocate(sizeof(EventValue) * ChunkSize, alignof(EventValue))));
+
+		new (&At(m_Count)) EventValue(event);
+		m_Count++;
+	}
+
+	void EventBus::Dispatch(const EventCallbackFn& callback)
+	{
+		m_Dispatching = true;
+
+		// Handlers may queue more events, those are delivered in the same pass
+		for (m_DispatchIndex = 0; m_DispatchIndex < m_Count; ++m_DispatchIndex)
+			callback(At(m_DispatchIndex));
+
+		m_Dispatching = false;
+		Reset();
+	}
+
+	bool EventBus::TryCoalesce(const EventValue& event)
+	{
+		if (m_Count == 0)
+			return false;
+
+		// Never touch an event that is already being (or has been) dispatched
+		size_t lastIndex = m_Count - 1;
+		if (m_Dispatching && lastIndex <= m_DispatchIndex)
+			return false;
+
+		EventValue& last = At(lastIndex);
+		if (last.GetEventType() != event.GetEventType() || last.IsHandled())
+			return false;
+
+		switch (event.GetEventType())
+		{
+		case EventType::MouseMoved:
+		case EventType::WindowResize:
+			last = event;
+			return true;
+		case EventType::MouseScrolled:
+		{
+			const MouseScrolledEvent& previous = *last.Get<MouseScrolledEvent>();
+			const MouseScrolledEvent& scrolled = *event.Get<MouseScrolledEvent>();
+			last = MouseScrolledEvent(previous.GetXOffset() + scrolled.GetXOffset(), previous.GetYOffset() + scrolled.GetYOffset());
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	void EventBus::Reset()
+	{
+		// Only a frame busier than any before it makes the arena grow
+		m_Arena.Reset();
+		m_Chunks.clear();
+		m_Count = 0;
+		m_DispatchIndex = 0;
+		m_CoalescedCount = 0;
+	}
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "Event.h"
+#include "EventValue.h"
+#include "PulseStudio/Memory/LinearArena.h"
+
+namespace PulseStudio {
+
+	/*
+	* Per-frame event queue. Platform callbacks copy their events as EventValues into fixed-size chunks
+	* of a LinearArena instead of dispatching them immediately, and the application drains the queue
+	* once per frame. The arena is reset after dispatch and keeps its blocks, so steady-state queuing
+	* does not allocate (and shows up in the Memory frame stats), and queued events never move while
+	* handlers add more.
+	* Consecutive MouseMoved and WindowResize events collapse to the latest value and consecutive
+	* MouseScrolled events sum their offsets, so a fast trackpad costs one dispatch per frame.
+	*/
+	class EventBus
+	{
+	public:
+		using EventCallbackFn = std::function<void(EventValue&)>;
+
+		static constexpr size_t ChunkSize = 64;
+
+		EventBus(size_t blockSize = LinearArena::DefaultBlockSize);
+		~EventBus() = default;
+
+		EventBus(const EventBus&) = delete;
+		EventBus& operator=(const EventBus&) = delete;
+
+		// Copy an event into this frame's queue, merging it into the previous one when possible
+		void Enqueue(const Event& event);
+		void Enqueue(const EventValue& event);
+
+		// Dispatch queued events in order (including ones queued meanwhile) and reset the queue
+		void Dispatch(const EventCallbackFn& callback);
+
+		inline size_t GetQueuedCount() const { return m_Count; }
+		inline uint32_t GetCoalescedCount() const { return m_CoalescedCount; }
+	private:
+		bool TryCoalesce(const EventValue& event);
+		void Reset();
+
+		inline EventValue& At(size_t index) { return m_Chunks[index / ChunkSize][index % ChunkSize]; }
+
+		LinearArena m_Arena;
+		std::vector<EventValue*> m_Chunks;
+		size_t m_Count = 0;
+		size_t m_DispatchIndex = 0;
+		bool m_Dispatching = false;
+		uint32_t m_CoalescedCount = 0;
+	};
+
+}
@@ -0,0 +1,181 @@
+#include "pspch.h"
+#include "EventRecording.h"
+
+#include "PulseStudio/BinaryLogFormat.h"
+
+namespace PulseStudio {
+
+	static constexpr char s_RecordingMagic[8] = { 'P', 'S', 'E', 'V', 'R', 'E', 'C', '\n' };
+	static constexpr uint16_t s_RecordingVersion = 1;
+	static constexpr size_t s_FlushThreshold = 64 * 1024;
+
+	EventRecorder::~EventRecorder()
+	{
+		Stop();
+	}
+
+	bool EventRecorder::Start(const std::string& path)
+	{
+		Stop();
+
+		m_File.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!m_File.is_open())
+		{
+			PS_CORE_ERROR("Failed to open event recording {0}", path);
+			return false;
+		}
+
+		m_Buffer.clear();
+		m_Buffer.reserve(s_FlushThreshold + 64);
+		BinaryLog::WriteRaw(m_Buffer, s_RecordingMagic, sizeof(s_RecordingMagic));
+		BinaryLog::WriteRaw(m_Buffer, &s_RecordingVersion, sizeof(s_RecordingVersion));
+
+		m_FirstRecord = true;
+		m_RecordedCount = 0;
+		PS_CORE_INFO("Recording events to {0}", path);
+		return true;
+	}
+
+	void EventRecorder::Stop()
+	{
+		if (!m_File.is_open())
+			return;
+
+		Flush();
+		m_File.close();
+		PS_CORE_INFO("Event recording stopped, {0} events recorded.", m_RecordedCount);
+	}
+
+	void EventRecorder::Record(const EventValue& event)
+	{
+		if (!m_File.is_open())
+			return;
+
+		auto now = std::chrono::steady_clock::now();
+		uint64_t delta = m_FirstRecord ? 0 : (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_LastTime).count();
+		m_LastTime = now;
+		m_FirstRecord = false;
+
+		BinaryLog::WriteVarint(m_Buffer, delta);
+		m_Buffer += (char)event.GetEventType();
+
+		std::string& out = m_Buffer;
+		auto writeFloat = [&out](float value) { BinaryLog::WriteRaw(out, &value, sizeof(value)); };
+		event.Visit(Overloaded{
+			[&](const WindowResizeEvent& e) { BinaryLog::WriteVarint(out, e.GetWidth()); BinaryLog::WriteVarint(out, e.GetHeight()); },
+			[&](const KeyPressedEvent& e) { BinaryLog::WriteZigzag(out, e.GetKeyCode()); BinaryLog::WriteVarint(out, (uint64_t)e.GetRepeatCount()); },
+			[&](const KeyReleasedEvent& e) { BinaryLog::WriteZigzag(out, e.GetKeyCode()); },
+			[&](const MouseButtonPressedEvent& e) { BinaryLog::WriteVarint(out, (uint64_t)e.GetMouseButton()); writeFloat(e.GetMousePosition().x); writeFloat(e.GetMousePosition().y); },
+			[&](const MouseButtonReleasedEvent& e) { BinaryLog::WriteVarint(out, (uint64_t)e.GetMouseButton()); writeFloat(e.GetMousePosition().x); writeFloat(e.GetMousePosition().y); },
+			[&](const MouseMovedEvent& e) { writeFloat(e.GetX()); writeFloat(e.GetY()); },
+			[&](const MouseScrolledEvent& e) { writeFloat(e.GetXOffset()); writeFloat(e.GetYOffset()); },
+			[](const auto&) {}
+		});
+
+		m_RecordedCount++;
+		if (m_Buffer.size() >= s_FlushThreshold)
+			Flush();
+	}
+
+	void EventRecorder::Flush()
+	{
+		m_File.write(m_Buffer.data(), (std::streamsize)m_Buffer.size());
+		m_Buffer.clear();
+	}
+
+	static bool ReadFloat(BinaryLog::Reader& reader, float& value)
+	{
+		return reader.ReadRaw(&value, sizeof(value));
+	}
+
+	static std::optional<EventValue> ReadEvent(BinaryLog::Reader& reader, EventType type)
+	{
+		uint64_t a = 0, b = 0;
+		int64_t key = 0;
+		float x = 0.0f, y = 0.0f;
+
+		switch (type)
+		{
+		case EventType::WindowClose:  return EventValue(WindowCloseEvent());
+		case EventType::AppTick:      return EventValue(AppTickEvent());
+		case EventType::AppUpdate:    return EventValue(AppUpdateEvent());
+		case EventType::AppRender:    return EventValue(AppRenderEvent());
+		case EventType::WindowResize:
+			if (reader.ReadVarint(a) && reader.ReadVarint(b))
+				return EventValue(WindowResizeEvent((unsigned int)a, (unsigned int)b));
+			break;
+		case EventType::KeyPressed:
+			if (reader.ReadZigzag(key) && reader.ReadVarint(a))
+				return EventValue(KeyPressedEvent((int)key, (int)a));
+			break;
+		case EventType::KeyReleased:
+			if (reader.ReadZigzag(key))
+				return EventValue(KeyReleasedEvent((int)key));
+			break;
+		case EventType::MouseButtonPressed:
+			if (reader.ReadVarint(a) && ReadFloat(reader, x) && ReadFloat(reader, y))
+				return EventValue(MouseButtonPressedEvent((int)a, x, y));
+			break;
+		case EventType::MouseButtonReleased:
+			if (reader.ReadVarint(a) && ReadFloat(reader, x) && ReadFloat(reader, y))
+				return EventValue(MouseButtonReleasedEvent((int)a, x, y));
+			break;
+		case EventType::MouseMoved:
+			if (ReadFloat(reader, x) && ReadFloat(reader, y))
+				return EventValue(MouseMovedEvent(x, y));
+			break;
+		case EventType::MouseScrolled:
+			if (ReadFloat(reader, x) && ReadFloat(reader, y))
+				return EventValue(MouseScrolledEvent(x, y));
+			break;
+		default:
+			break;
+		}
+
+		return std::nullopt;
+	}
+
+	bool LoadEventRecording(const std::string& path, std::vector<RecordedEvent>& events)
+	{
+		std::ifstream file(path, std::ios::in | std::ios::binary);
+		if (!file.is_open())
+		{
+			PS_CORE_ERROR("Failed to open event recording {0}", path);
+			return false;
+		}
+		std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		BinaryLog::Reader reader(data.data(), data.size());
+		char magic[sizeof(s_RecordingMagic)];
+		uint16_t version;
+		if (!reader.ReadRaw(magic, sizeof(magic)) || std::memcmp(magic, s_RecordingMagic, sizeof(magic)) != 0
+			|| !reader.ReadRaw(&version, sizeof(version)) || version != s_RecordingVersion)
+		{
+			PS_CORE_ERROR("{0} is not a supported event recording.", path);
+			return false;
+		}
+
+		events.clear();
+		std::chrono::nanoseconds time(0);
+		while (!reader.AtEnd())
+		{
+			uint64_t delta;
+			uint8_t type;
+			if (!reader.ReadVarint(delta) || !reader.ReadByte(type))
+				break;
+
+			std::optional<EventValue> event = type < EventTypeCount ? ReadEvent(reader, (EventType)type) : std::nullopt;
+			if (!event)
+			{
+				PS_CORE_ERROR("Corrupt event recording {0} at offset {1}, stopping.", path, reader.GetOffset());
+				return false;
+			}
+
+			time += std::chrono::nanoseconds(delta);
+			events.push_back({ time, *event });
+		}
+
+		return true;
+	}
+
+}
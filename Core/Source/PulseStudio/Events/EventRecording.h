@@ -0,0 +1,56 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "EventValue.h"
+
+namespace PulseStudio {
+
+	// An event read back from a recording, Time is relative to the first recorded event
+	struct RecordedEvent
+	{
+		std::chrono::nanoseconds Time;
+		EventValue Event;
+	};
+
+	/*
+	* Writes dispatched events to a compact binary file so interactive sessions (typing bursts, fast
+	* scrolling, window resizes) can be replayed later with EventReplay. Records are encoded with the
+	* binary log's varint helpers and buffered in memory, the file is written in 64 KB chunks.
+	*
+	* File   := magic[8] version:u16 Record*
+	* Record := timeDelta:varint type:u8 payload
+	*
+	* The time delta is in nanoseconds since the previous record, payloads are varints for sizes,
+	* key codes and buttons (zigzag for key codes) and raw little-endian floats for positions.
+	*/
+	class EventRecorder
+	{
+	public:
+		EventRecorder() = default;
+		~EventRecorder();
+
+		EventRecorder(const EventRecorder&) = delete;
+		EventRecorder& operator=(const EventRecorder&) = delete;
+
+		bool Start(const std::string& path);
+		void Stop();
+
+		inline bool IsRecording() const { return m_File.is_open(); }
+		inline size_t GetRecordedCount() const { return m_RecordedCount; }
+
+		void Record(const EventValue& event);
+	private:
+		void Flush();
+
+		std::ofstream m_File;
+		std::string m_Buffer;
+		std::chrono::steady_clock::time_point m_LastTime;
+		bool m_FirstRecord = true;
+		size_t m_RecordedCount = 0;
+	};
+
+	// Read a recording written by EventRecorder, returns false if the file is missing or corrupt
+	bool LoadEventRecording(const std::string& path, std::vector<RecordedEvent>& events);
+
+}
@@ -0,0 +1,61 @@
+#include "pspch.h"
+#include "EventReplay.h"
+
+#include <cmath>
+
+namespace PulseStudio {
+
+	ReplayStats EventReplay::Run(const std::vector<RecordedEvent>& events, ReplayTiming timing, const EventCallbackFn& callback)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		ReplayStats stats;
+		std::vector<std::chrono::nanoseconds> latencies;
+		latencies.reserve(events.size());
+
+		Clock::time_point start = Clock::now();
+		for (const RecordedEvent& recorded : events)
+		{
+			Clock::time_point due = Clock::now();
+			if (timing == ReplayTiming::Original)
+			{
+				Clock::time_point scheduled = start + recorded.Time;
+				if (scheduled > due)
+					std::this_thread::sleep_until(scheduled);
+				due = scheduled;
+			}
+
+			// Handlers may mark the event handled, so every delivery gets a fresh copy
+			EventValue event = recorded.Event;
+			callback(event);
+
+			latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - due));
+		}
+		stats.Duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+		stats.EventCount = latencies.size();
+
+		if (latencies.empty())
+			return stats;
+
+		// Nearest-rank percentiles
+		std::sort(latencies.begin(), latencies.end());
+		auto percentile = [&latencies](double p)
+		{
+			size_t rank = (size_t)std::ceil(p * latencies.size());
+			return latencies[std::clamp<size_t>(rank, 1, latencies.size()) - 1];
+		};
+		stats.P50 = percentile(0.50);
+		stats.P90 = percentile(0.90);
+		stats.P99 = percentile(0.99);
+		stats.Max = latencies.back();
+		return stats;
+	}
+
+	void EventReplay::LogStats(const ReplayStats& stats)
+	{
+		auto us = [](std::chrono::nanoseconds value) { return value.count() / 1000.0; };
+		PS_CORE_INFO("Replayed {0} events in {1:.3f} ms, latency p50 {2:.2f} us, p90 {3:.2f} us, p99 {4:.2f} us, max {5:.2f} us",
+			stats.EventCount, us(stats.Duration) / 1000.0, us(stats.P50), us(stats.P90), us(stats.P99), us(stats.Max));
+	}
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "EventRecording.h"
+
+namespace PulseStudio {
+
+	enum class ReplayTiming
+	{
+		Original = 0,		// Deliver each event at its recorded offset from the start
+		AsFastAsPossible	// Deliver events back to back
+	};
+
+	// Per-event handling latency over a replay
+	struct ReplayStats
+	{
+		size_t EventCount = 0;
+		std::chrono::nanoseconds Duration{ 0 };
+		std::chrono::nanoseconds P50{ 0 };
+		std::chrono::nanoseconds P90{ 0 };
+		std::chrono::nanoseconds P99{ 0 };
+		std::chrono::nanoseconds Max{ 0 };
+	};
+
+	/*
+	* Feeds a recording back through an event callback (normally Application::OnEvent) without a
+	* window. Latency is measured from when an event was due to when its handler returned, so with
+	* Original timing a slow handler also shows up in the latency of the events queued behind it.
+	*/
+	class EventReplay
+	{
+	public:
+		using EventCallbackFn = std::function<void(EventValue&)>;
+
+		static ReplayStats Run(const std::vector<RecordedEvent>& events, ReplayTiming timing, const EventCallbackFn& callback);
+
+		static void LogStats(const ReplayStats& stats);
+	};
+
+}
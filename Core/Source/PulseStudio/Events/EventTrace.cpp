@@ -0,0 +1,69 @@
+#include "pspch.h"
+#include "EventTrace.h"
+
+namespace PulseStudio {
+
+#ifdef DIST
+	EventTraceMode EventTrace::s_Mode = EventTraceMode::Off;
+#else
+	EventTraceMode EventTrace::s_Mode = EventTraceMode::Sampled;
+#endif
+	uint32_t EventTrace::s_SampleInterval = 0;
+	std::array<uint32_t, EventTypeCount> EventTrace::s_FrameCounts = {};
+	std::array<uint32_t, EventTypeCount> EventTrace::s_FrameTraced = {};
+	std::array<uint64_t, EventTypeCount> EventTrace::s_TotalCounts = {};
+
+	void EventTrace::Init()
+	{
+		const char* mode = std::getenv("PS_EVENT_TRACE");
+		if (!mode)
+			return;
+
+		std::string value(mode);
+		if (value == "off")
+			s_Mode = EventTraceMode::Off;
+		else if (value == "sampled")
+			s_Mode = EventTraceMode::Sampled;
+		else if (value == "full")
+			s_Mode = EventTraceMode::Full;
+		else
+			PS_CORE_WARN("Unknown PS_EVENT_TRACE value '{0}', expected off, sampled or full.", value);
+	}
+
+	void EventTrace::RecordImpl(const EventValue& event)
+	{
+		// Counting is cheap, the string is only built when it will actually be logged
+		size_t type = (size_t)event.GetEventType();
+		uint64_t total = ++s_TotalCounts[type];
+		s_FrameCounts[type]++;
+
+		if (!Logger::getInstance().shouldLog(LogLevel::Trace))
+			return;
+
+		if (s_Mode == EventTraceMode::Sampled && IsHighFrequency(event.GetEventType()))
+		{
+			if (s_SampleInterval == 0 || total % s_SampleInterval != 0)
+				return;
+		}
+
+		s_FrameTraced[type]++;
+		PS_CORE_TRACE("{0}", event.AsEvent().ToString());
+	}
+
+	void EventTrace::EndFrame()
+	{
+		if (s_Mode == EventTraceMode::Sampled && Logger::getInstance().shouldLog(LogLevel::Trace))
+		{
+			for (size_t type = 0; type < EventTypeCount; type++)
+			{
+				uint32_t skipped = s_FrameCounts[type] - s_FrameTraced[type];
+				if (IsHighFrequency((EventType)type) && skipped > 0)
+					PS_CORE_TRACE("{0} x{1} this frame ({2} traced)", type == (size_t)EventType::MouseMoved ? "MouseMoved" : "MouseScrolled", s_FrameCounts[type], s_FrameTraced[type]);
+			}
+		}
+
+		s_FrameCounts.fill(0);
+		s_FrameTraced.fill(0);
+	}
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "EventValue.h"
+
+namespace PulseStudio {
+
+	enum class EventTraceMode
+	{
+		Off = 0,	// Nothing is traced, Record() is a single compare
+		Sampled,	// Every event is traced except high-frequency ones, which are sampled and counted per frame
+		Full		// Every event is traced
+	};
+
+	/*
+	* Runtime-configurable event tracing. Events are only stringified when tracing is on and the
+	* Trace log level is enabled. High-frequency events (MouseMoved, MouseScrolled) are sampled in
+	* Sampled mode and reported as per-frame counts instead.
+	* The initial mode comes from the PS_EVENT_TRACE environment variable (off, sampled, full).
+	*/
+	class EventTrace
+	{
+	public:
+		static void Init();
+
+		static void SetMode(EventTraceMode mode) { s_Mode = mode; }
+		static EventTraceMode GetMode() { return s_Mode; }
+
+		// Trace one of every N high-frequency events in Sampled mode, 0 only counts them
+		static void SetSampleInterval(uint32_t interval) { s_SampleInterval = interval; }
+		static uint32_t GetSampleInterval() { return s_SampleInterval; }
+
+		inline static void Record(const EventValue& event)
+		{
+			if (s_Mode != EventTraceMode::Off)
+				RecordImpl(event);
+		}
+
+		// Report the per-frame counts of sampled events
+		static void EndFrame();
+	private:
+		static void RecordImpl(const EventValue& event);
+
+		static bool IsHighFrequency(EventType type)
+		{
+			return type == EventType::MouseMoved || type == EventType::MouseScrolled;
+		}
+
+		static EventTraceMode s_Mode;
+		static uint32_t s_SampleInterval;
+		static std::array<uint32_t, EventTypeCount> s_FrameCounts;
+		static std::array<uint32_t, EventTypeCount> s_FrameTraced;
+		static std::array<uint64_t, EventTypeCount> s_TotalCounts;
+	};
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "pspch.h"
+
+#include <optional>
+#include <variant>
+
+#include "Event.h"
+#include "ApplicationEvent.h"
+#include "KeyEvent.h"
+#include "MouseEvent.h"
+
+namespace PulseStudio {
+
+	template<typename... Ts>
+	struct Overloaded : Ts... { using Ts::operator()...; };
+	template<typename... Ts>
+	Overloaded(Ts...) -> Overloaded<Ts...>;
+
+	/*
+	* Value-type event: a std::variant of the concrete event classes plus inline type and category
+	* flags. It can be stored and copied without allocation, and inspecting or visiting it never goes
+	* through the vtable (std::visit compiles to a jump table). AsEvent() adapts it to the polymorphic
+	* Event& API for layers and EventDispatcher.
+	*/
+	class EventValue
+	{
+	public:
+		using Variant = std::variant<
+			WindowCloseEvent, WindowResizeEvent,
+			AppTickEvent, AppUpdateEvent, AppRenderEvent,
+			KeyPressedEvent, KeyReleasedEvent,
+			MouseButtonPressedEvent, MouseButtonReleasedEvent, MouseMovedEvent, MouseScrolledEvent>;
+
+		template<typename T>
+		EventValue(const T& event)
+			: m_Event(std::in_place_type<T>, event), m_Type(T::GetStaticType()), m_CategoryFlags(T::GetStaticCategoryFlags())
+		{
+		}
+
+		// Adapter from the polymorphic API, empty for event types the variant does not hold
+		static std::optional<EventValue> From(const Event& event)
+		{
+			switch (event.GetEventType())
+			{
+			case EventType::WindowClose:         return EventValue(static_cast<const WindowCloseEvent&>(event));
+			case EventType::WindowResize:        return EventValue(static_cast<const WindowResizeEvent&>(event));
+			case EventType::AppTick:             return EventValue(static_cast<const AppTickEvent&>(event));
+			case EventType::AppUpdate:           return EventValue(static_cast<const AppUpdateEvent&>(event));
+			case EventType::AppRender:           return EventValue(static_cast<const AppRenderEvent&>(event));
+			case EventType::KeyPressed:          return EventValue(static_cast<const KeyPressedEvent&>(event));
+			case EventType::KeyReleased:         return EventValue(static_cast<const KeyReleasedEvent&>(event));
+			case EventType::MouseButtonPressed:  return EventValue(static_cast<const MouseButtonPressedEvent&>(event));
+			case EventType::MouseButtonReleased: return EventValue(static_cast<const MouseButtonReleasedEvent&>(event));
+			case EventType::MouseMoved:          return EventValue(static_cast<const MouseMovedEvent&>(event));
+			case EventType::MouseScrolled:       return EventValue(static_cast<const MouseScrolledEvent&>(event));
+			default:                             return std::nullopt;
+			}
+		}
+
+		inline EventType GetEventType() const { return m_Type; }
+		inline int GetCategoryFlags() const { return m_CategoryFlags; }
+		inline bool IsInCategory(EventCategory category) const { return m_CategoryFlags & category; }
+
+		inline bool IsHandled() const { return AsEvent().m_Handled; }
+
+		template<typename T>
+		inline T* Get() { return std::get_if<T>(&m_Event); }
+		template<typename T>
+		inline const T* Get() const { return std::get_if<T>(&m_Event); }
+
+		// Switch over the concrete type, e.g. Visit(Overloaded{ [](MouseMovedEvent& e) {...}, [](auto&) {} })
+		template<typename F>
+		inline decltype(auto) Visit(F&& func) { return std::visit(std::forward<F>(func), m_Event); }
+		template<typename F>
+		inline decltype(auto) Visit(F&& func) const { return std::visit(std::forward<F>(func), m_Event); }
+
+		// Adapter to the polymorphic API
+		inline Event& AsEvent() { return std::visit([](auto& e) -> Event& { return e; }, m_Event); }
+		inline const Event& AsEvent() const { return std::visit([](const auto& e) -> const Event& { return e; }, m_Event); }
+
+		// Dispatcher for the adapted event that reuses the inline type instead of a virtual call
+		inline EventDispatcher GetDispatcher() { return EventDispatcher(AsEvent(), m_Type); }
+	private:
+		Variant m_Event;
+		EventType m_Type;
+		int m_CategoryFlags;
+	};
+
+	template<size_t... I>
+	constexpr std::array<int, EventTypeCount> BuildEventCategoryTable(std::index_sequence<I...>)
+	{
+		std::array<int, EventTypeCount> table{};
+		((table[(size_t)std::variant_alternative_t<I, EventValue::Variant>::GetStaticType()] = std::variant_alternative_t<I, EventValue::Variant>::GetStaticCategoryFlags()), ...);
+		return table;
+	}
+
+	inline constexpr std::array<int, EventTypeCount> s_EventCategoryTable = BuildEventCategoryTable(std::make_index_sequence<std::variant_size_v<EventValue::Variant>>());
+
+	// Category flags of an event type without an instance
+	constexpr int GetEventCategoryFlags(EventType type)
+	{
+		return s_EventCategoryTable[(size_t)type];
+	}
+
+}
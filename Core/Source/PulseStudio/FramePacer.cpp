@@ -0,0 +1,102 @@
+#include "pspch.h"
+#include "FramePacer.h"
+
+#include <cmath>
+
+#ifdef PS_PLATFORM_WINDOWS
+#include <timeapi.h>
+#endif
+
+namespace PulseStudio {
+
+	FramePacer::FramePacer(uint32_t targetRate)
+	{
+		SetTargetRate(targetRate);
+	}
+
+	FramePacer::~FramePacer()
+	{
+		SetTimerResolution(false);
+	}
+
+	void FramePacer::SetTargetRate(uint32_t targetRate)
+	{
+		m_TargetRate = targetRate;
+		m_Budget = targetRate > 0
+			? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetRate))
+			: Clock::duration::zero();
+		m_Deadline = Clock::now() + m_Budget;
+
+		// Uncapped runs never sleep, they leave the system timer alone
+		SetTimerResolution(targetRate > 0);
+	}
+
+	float FramePacer::BeginFrame()
+	{
+		Clock::time_point now = Clock::now();
+		m_DeltaTime = m_FirstFrame ? 0.0f : std::chrono::duration<float>(now - m_FrameStart).count();
+		m_FrameStart = now;
+
+		if (m_FirstFrame || now > m_Deadline + m_Budget)
+		{
+			// First frame or we fell more than a frame behind, restart the schedule
+			m_Deadline = now + m_Budget;
+		}
+		else
+		{
+			m_Deadline += m_Budget;
+		}
+
+		m_FirstFrame = false;
+		return m_DeltaTime;
+	}
+
+	void FramePacer::Wait()
+	{
+		Clock::time_point now = Clock::now();
+		m_WorkTime = std::chrono::duration<float>(now - m_FrameStart).count();
+
+		if (m_TargetRate == 0 || now >= m_Deadline)
+			return;
+
+		SleepUntil(m_Deadline);
+	}
+
+	void FramePacer::SleepUntil(Clock::time_point deadline)
+	{
+		// Coarse phase: real sleeps while we are safely above the overshoot estimate
+		while (std::chrono::duration<double>(deadline - Clock::now()).count() > m_SleepEstimate)
+		{
+			Clock::time_point start = Clock::now();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			double observed = std::chrono::duration<double>(Clock::now() - start).count();
+
+			// Welford update of the mean and variance of a 1 ms sleep
+			m_SleepCount++;
+			double delta = observed - m_SleepMean;
+			m_SleepMean += delta / m_SleepCount;
+			m_SleepM2 += delta * (observed - m_SleepMean);
+			m_SleepEstimate = m_SleepMean + std::sqrt(m_SleepM2 / (m_SleepCount - 1));
+		}
+
+		// Fine phase: spin the last stretch
+		while (Clock::now() < deadline)
+			std::this_thread::yield();
+	}
+
+	void FramePacer::SetTimerResolution(bool high)
+	{
+		if (high == m_HighResolutionTimer)
+			return;
+
+#ifdef PS_PLATFORM_WINDOWS
+		// The period is system-wide and reference counted, every begin needs its matching end
+		if (high)
+			timeBeginPeriod(1);
+		else
+			timeEndPeriod(1);
+#endif
+		m_HighResolutionTimer = high;
+	}
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "pspch.h"
+
+namespace PulseStudio {
+
+	/*
+	* Paces the main loop to a target frame rate (60, 120, 144 Hz, ... or 0 for uncapped benchmark
+	* runs) and measures the real frame delta with steady_clock.
+	* Wait() sleeps only for what is left of the frame budget: it sleeps in 1 ms steps while the
+	* remaining time is comfortably above the observed sleep overshoot, then spins to the deadline.
+	* The overshoot estimate (mean + one standard deviation) adapts to the OS timer resolution.
+	* Deadlines follow a fixed schedule, a frame that runs late starts a new schedule instead of
+	* making the following frames rush to catch up. When something else already blocks for the
+	* budget (e.g. VSync at the same rate) the deadline has passed by the time Wait() runs and it
+	* returns immediately.
+	* On Windows a capped pacer holds the system timer at 1 ms resolution (timeBeginPeriod), without
+	* it a 1 ms sleep lasts a whole 15.6 ms scheduler tick and the coarse phase is useless.
+	*/
+	class FramePacer
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		FramePacer(uint32_t targetRate = 60);
+		~FramePacer();
+
+		FramePacer(const FramePacer&) = delete;
+		FramePacer& operator=(const FramePacer&) = delete;
+
+		void SetTargetRate(uint32_t targetRate);
+		inline uint32_t GetTargetRate() const { return m_TargetRate; }
+
+		// Start a frame, returns seconds since the previous frame started
+		float BeginFrame();
+
+		// Sleep and spin until the frame budget is used up, no-op when uncapped
+		void Wait();
+
+		inline float GetDeltaTime() const { return m_DeltaTime; }
+		// Seconds spent between BeginFrame and Wait in the last frame
+		inline float GetWorkTime() const { return m_WorkTime; }
+	private:
+		void SleepUntil(Clock::time_point deadline);
+		void SetTimerResolution(bool high);
+
+		uint32_t m_TargetRate = 0;
+		Clock::duration m_Budget{ 0 };
+		Clock::time_point m_FrameStart;
+		Clock::time_point m_Deadline;
+		float m_DeltaTime = 0.0f;
+		float m_WorkTime = 0.0f;
+		bool m_FirstFrame = true;
+		bool m_HighResolutionTimer = false;
+
+		// Running statistics of how long a 1 ms sleep really takes, in seconds
+		double m_SleepEstimate = 0.005;
+		double m_SleepMean = 0.005;
+		double m_SleepM2 = 0.0;
+		uint64_t m_SleepCount = 1;
+	};
+
+}
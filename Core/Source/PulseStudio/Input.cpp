@@ -0,0 +1,70 @@
+#include "pspch.h"
+#include "Input.h"
+
+#include "Events/EventValue.h"
+
+namespace PulseStudio {
+
+	InputState Input::s_State;
+
+	void Input::Init()
+	{
+		s_State.Reset();
+	}
+
+	void InputState::BeginFrame()
+	{
+		m_KeysPressed.reset();
+		m_KeysReleased.reset();
+		m_ButtonsPressed.reset();
+		m_ButtonsReleased.reset();
+	}
+
+	void InputState::OnEvent(const EventValue& event)
+	{
+		event.Visit(Overloaded{
+			[this](const KeyPressedEvent& e)
+			{
+				if (!IsValidKey(e.GetKeyCode()))
+					return;
+				// Auto-repeat keeps the key down but is not a new press
+				if (e.GetRepeatCount() == 0)
+					m_KeysPressed.set(e.GetKeyCode());
+				m_KeysDown.set(e.GetKeyCode());
+			},
+			[this](const KeyReleasedEvent& e)
+			{
+				if (!IsValidKey(e.GetKeyCode()))
+					return;
+				m_KeysDown.reset(e.GetKeyCode());
+				m_KeysReleased.set(e.GetKeyCode());
+			},
+			[this](const MouseButtonPressedEvent& e)
+			{
+				if (!IsValidButton(e.GetMouseButton()))
+					return;
+				m_ButtonsDown.set(e.GetMouseButton());
+				m_ButtonsPressed.set(e.GetMouseButton());
+			},
+			[this](const MouseButtonReleasedEvent& e)
+			{
+				if (!IsValidButton(e.GetMouseButton()))
+					return;
+				m_ButtonsDown.reset(e.GetMouseButton());
+				m_ButtonsReleased.set(e.GetMouseButton());
+			},
+			[this](const MouseMovedEvent& e)
+			{
+				m_MouseX = e.GetX();
+				m_MouseY = e.GetY();
+			},
+			[](const auto&) {}
+		});
+	}
+
+	void InputState::Reset()
+	{
+		*this = InputState();
+	}
+
+}
@@ -2,30 +2,77 @@
 
 #include "pspch.h"
 
+#include <bitset>
+
 namespace PulseStudio {
 
+	class EventValue;
+
+	/*
+	* Keyboard and mouse state for the current frame, built from the dispatched event stream.
+	* Down state persists across frames, the pressed/released edges cover the events dispatched
+	* since the last BeginFrame(), so a key tapped within a single frame still shows up as pressed.
+	*/
+	class InputState
+	{
+	public:
+		static constexpr size_t KeyCount = PS_KEY_LAST + 1;
+		static constexpr size_t MouseButtonCount = PS_MOUSE_BUTTON_LAST + 1;
+
+		void BeginFrame();
+		void OnEvent(const EventValue& event);
+		void Reset();
+
+		inline bool IsKeyDown(int keycode) const { return IsValidKey(keycode) && m_KeysDown[keycode]; }
+		inline bool IsKeyJustPressed(int keycode) const { return IsValidKey(keycode) && m_KeysPressed[keycode]; }
+		inline bool IsKeyJustReleased(int keycode) const { return IsValidKey(keycode) && m_KeysReleased[keycode]; }
+
+		inline bool IsMouseButtonDown(int button) const { return IsValidButton(button) && m_ButtonsDown[button]; }
+		inline bool IsMouseButtonJustPressed(int button) const { return IsValidButton(button) && m_ButtonsPressed[button]; }
+		inline bool IsMouseButtonJustReleased(int button) const { return IsValidButton(button) && m_ButtonsReleased[button]; }
+
+		inline float GetMouseX() const { return m_MouseX; }
+		inline float GetMouseY() const { return m_MouseY; }
+	private:
+		static inline bool IsValidKey(int keycode) { return (unsigned int)keycode < KeyCount; }
+		static inline bool IsValidButton(int button) { return (unsigned int)button < MouseButtonCount; }
+
+		std::bitset<KeyCount> m_KeysDown;
+		std::bitset<KeyCount> m_KeysPressed;
+		std::bitset<KeyCount> m_KeysReleased;
+		std::bitset<MouseButtonCount> m_ButtonsDown;
+		std::bitset<MouseButtonCount> m_ButtonsPressed;
+		std::bitset<MouseButtonCount> m_ButtonsReleased;
+		float m_MouseX = 0.0f, m_MouseY = 0.0f;
+	};
+
+	// Polling API, every query is an inline read of the frame's InputState snapshot
 	class Input
 	{
 	public:
 		static void Init();
 
-		inline static bool IsKeyPressed(int keycode) { return s_Instance->IsKeyPressedImpl(keycode); }
+		// Fed by the Application, once per frame and once per dispatched event
+		static void BeginFrame() { s_State.BeginFrame(); }
+		static void OnEvent(const EventValue& event) { s_State.OnEvent(event); }
 
-		inline static bool IsMouseButtonPressed(int button) { return s_Instance->IsMouseButtonPressedImpl(button); }
+		// IsKeyPressed/IsMouseButtonPressed keep their original meaning of "is down", the Just*
+		// queries are the edges since the last frame
+		inline static bool IsKeyPressed(int keycode) { return s_State.IsKeyDown(keycode); }
+		inline static bool IsKeyJustPressed(int keycode) { return s_State.IsKeyJustPressed(keycode); }
+		inline static bool IsKeyJustReleased(int keycode) { return s_State.IsKeyJustReleased(keycode); }
 
-		inline static std::pair<float, float> GetMousePosition() { return s_Instance->GetMousePositionImpl(); }
-		inline static float GetMouseX() { return s_Instance->GetMouseXImpl(); }
-		inline static float GetMouseY() { return s_Instance->GetMouseYImpl(); }
-	protected:
-		virtual bool IsKeyPressedImpl(int keycode) = 0;
+		inline static bool IsMouseButtonPressed(int button) { return s_State.IsMouseButtonDown(button); }
+		inline static bool IsMouseButtonJustPressed(int button) { return s_State.IsMouseButtonJustPressed(button); }
+		inline static bool IsMouseButtonJustReleased(int button) { return s_State.IsMouseButtonJustReleased(button); }
 
-		virtual bool IsMouseButtonPressedImpl(int button) = 0;
+		inline static std::pair<float, float> GetMousePosition() { return { s_State.GetMouseX(), s_State.GetMouseY() }; }
+		inline static float GetMouseX() { return s_State.GetMouseX(); }
+		inline static float GetMouseY() { return s_State.GetMouseY(); }
 
-		virtual std::pair<float, float> GetMousePositionImpl() = 0;
-		virtual float GetMouseXImpl() = 0;
-		virtual float GetMouseYImpl() = 0;
+		inline static const InputState& GetState() { return s_State; }
 	private:
-		static Input* s_Instance;
+		static InputState s_State;
 	};
 
 }
@@ -0,0 +1,388 @@
+#include "pspch.h"
+#include "JobSystem.h"
+
+#include "WorkStealingQueue.h"
+#include "PulseStudio/Profiler.h"
+#include "PulseStudio/Memory/PoolAllocator.h"
+
+#include <random>
+
+namespace PulseStudio {
+
+	// Jobs are shared between handles, queues and the continuation lists of their dependencies,
+	// each of those holds one reference
+	struct Job
+	{
+		std::function<void()> Work;
+		std::atomic<uint32_t> RefCount = 1;
+		// Unfinished dependencies plus one guard released once scheduling is complete
+		std::atomic<uint32_t> PendingDependencies = 1;
+		std::atomic<bool> Done = false;
+
+		std::mutex ContinuationMutex;
+		std::vector<Job*> Continuations;
+		bool Finished = false;
+	};
+
+	struct JobSystem::Worker
+	{
+		WorkStealingQueue<Job> Queue;
+		std::minstd_rand Random;
+		uint32_t Index = 0;
+	};
+
+	JobSystem* JobSystem::s_Instance = nullptr;
+	thread_local JobSystem::Worker* JobSystem::s_CurrentWorker = nullptr;
+
+	// Jobs are small and short-lived, recycle them instead of going through the heap each time
+	static ObjectPool<Job>& GetJobPool()
+	{
+		static ObjectPool<Job> s_JobPool(1024);
+		return s_JobPool;
+	}
+
+	static void AddRef(Job* job)
+	{
+		job->RefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static void Release(Job* job)
+	{
+		if (job->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			GetJobPool().Delete(job);
+	}
+
+	JobHandle::JobHandle(Job* job)
+		: m_Job(job)
+	{
+		if (m_Job)
+			AddRef(m_Job);
+	}
+
+	JobHandle::JobHandle(const JobHandle& other)
+		: JobHandle(other.m_Job)
+	{
+	}
+
+	JobHandle::JobHandle(JobHandle&& other) noexcept
+		: m_Job(std::exchange(other.m_Job, nullptr))
+	{
+	}
+
+	JobHandle& JobHandle::operator=(JobHandle other) noexcept
+	{
+		std::swap(m_Job, other.m_Job);
+		return *this;
+	}
+
+	JobHandle::~JobHandle()
+	{
+		if (m_Job)
+			Release(m_Job);
+	}
+
+	bool JobHandle::IsDone() const
+	{
+		return !m_Job || m_Job->Done.load(std::memory_order_acquire);
+	}
+
+	void JobHandle::Wait() const
+	{
+		JobSystem::Wait(*this);
+	}
+
+	JobHandle JobHandle::Then(std::function<void()> work) const
+	{
+		return JobSystem::Schedule(std::move(work), { *this });
+	}
+
+	void JobSystem::Init(uint32_t workerCount)
+	{
+		PS_CORE_ASSERT(!s_Instance, "JobSystem already initialized!");
+
+		if (workerCount == 0)
+		{
+			// The main thread works too while it waits, leave it a core
+			uint32_t cores = std::thread::hardware_concurrency();
+			workerCount = cores > 1 ? cores - 1 : 1;
+		}
+
+		s_Instance = new JobSystem(workerCount);
+		PS_CORE_INFO("Job system started with {0} workers", workerCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		delete s_Instance;
+		s_Instance = nullptr;
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return s_Instance ? (uint32_t)s_Instance->m_Workers.size() : 0;
+	}
+
+	JobSystem::JobSystem(uint32_t workerCount)
+	{
+		m_Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++)
+		{
+			auto worker = std::make_unique<Worker>();
+			worker->Index = i;
+			worker->Random.seed(i + 1);
+			m_Workers.push_back(std::move(worker));
+		}
+
+		// All deques exist before the first worker can try to steal
+		m_Threads.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++)
+			m_Threads.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_Running = false;
+		}
+		m_SleepCondition.notify_all();
+
+		for (std::thread& thread : m_Threads)
+			thread.join();
+
+		// Finish whatever is still queued so nobody waiting on a handle is left hanging
+		while (Job* job = FindJob())
+			Execute(job);
+
+		DrainMainThreadQueue();
+	}
+
+	void JobSystem::WorkerLoop(uint32_t index)
+	{
+		s_CurrentWorker = m_Workers[index].get();
+		Profiler::SetThreadName("Worker " + std::to_string(index));
+		PS_MEMORY_TAG(Jobs);
+
+		while (m_Running.load(std::memory_order_relaxed))
+		{
+			if (Job* job = FindJob())
+			{
+				Execute(job);
+				continue;
+			}
+
+			// Sleeping count before queued count here and the reverse in Enqueue, so either the
+			// worker sees the new job or Enqueue sees the sleeper and notifies under the lock
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_SleepingWorkers.fetch_add(1);
+			m_SleepCondition.wait(lock, [this]() { return m_QueuedJobs.load() > 0 || !m_Running.load(); });
+			m_SleepingWorkers.fetch_sub(1);
+		}
+
+		s_CurrentWorker = nullptr;
+	}
+
+	void JobSystem::Enqueue(Job* job)
+	{
+		m_QueuedJobs.fetch_add(1);
+
+		if (!s_CurrentWorker || !s_CurrentWorker->Queue.Push(job))
+		{
+			std::lock_guard<std::mutex> lock(m_InjectionMutex);
+			m_InjectionQueue.push_back(job);
+		}
+
+		if (m_SleepingWorkers.load() > 0)
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_SleepCondition.notify_one();
+		}
+	}
+
+	Job* JobSystem::FindJob()
+	{
+		Job* job = s_CurrentWorker ? s_CurrentWorker->Queue.Pop() : nullptr;
+
+		if (!job)
+		{
+			std::lock_guard<std::mutex> lock(m_InjectionMutex);
+			if (!m_InjectionQueue.empty())
+			{
+				job = m_InjectionQueue.front();
+				m_InjectionQueue.pop_front();
+			}
+		}
+
+		if (!job && !m_Workers.empty())
+		{
+			// Start at a random victim so thieves spread out
+			size_t count = m_Workers.size();
+			size_t start = s_CurrentWorker ? s_CurrentWorker->Random() % count : 0;
+			for (size_t i = 0; i < count && !job; i++)
+			{
+				Worker* victim = m_Workers[(start + i) % count].get();
+				if (victim != s_CurrentWorker)
+					job = victim->Queue.Steal();
+			}
+		}
+
+		if (job)
+			m_QueuedJobs.fetch_sub(1);
+		return job;
+	}
+
+	void JobSystem::Execute(Job* job)
+	{
+		{
+			PS_PROFILE_SCOPE("Job");
+			if (job->Work)
+				job->Work();
+			// Captures are released here, not whenever the last handle goes away
+			job->Work = nullptr;
+		}
+
+		FinishJob(job);
+		Release(job);
+	}
+
+	void JobSystem::FinishJob(Job* job)
+	{
+		std::vector<Job*> continuations;
+		{
+			std::lock_guard<std::mutex> lock(job->ContinuationMutex);
+			job->Finished = true;
+			continuations.swap(job->Continuations);
+		}
+		job->Done.store(true, std::memory_order_release);
+
+		for (Job* continuation : continuations)
+		{
+			ReleaseDependency(continuation);
+			Release(continuation);
+		}
+	}
+
+	void JobSystem::AddDependency(Job* job, Job* dependency)
+	{
+		std::lock_guard<std::mutex> lock(dependency->ContinuationMutex);
+		if (dependency->Finished)
+			return;
+
+		job->PendingDependencies.fetch_add(1, std::memory_order_relaxed);
+		AddRef(job);
+		dependency->Continuations.push_back(job);
+	}
+
+	void JobSystem::ReleaseDependency(Job* job)
+	{
+		if (job->PendingDependencies.fetch_sub(1, std::memory_order_acq_rel) != 1)
+			return;
+
+		// The queue's reference, dropped again once the job has run
+		AddRef(job);
+		if (s_Instance)
+			s_Instance->Enqueue(job);
+		else
+			Execute(job); // No workers (tools, or after shutdown), run in place
+	}
+
+	JobHandle JobSystem::Schedule(std::function<void()> work, std::initializer_list<JobHandle> dependencies)
+	{
+		return Schedule(std::move(work), std::vector<JobHandle>(dependencies));
+	}
+
+	JobHandle JobSystem::Schedule(std::function<void()> work, const std::vector<JobHandle>& dependencies)
+	{
+		Job* job = GetJobPool().New();
+		job->Work = std::move(work);
+		JobHandle handle(job);
+		Release(job);
+
+		for (const JobHandle& dependency : dependencies)
+		{
+			if (dependency.IsValid())
+				AddDependency(job, dependency.GetJob());
+		}
+
+		// Drop the scheduling guard, the job is queued now if nothing was pending
+		ReleaseDependency(job);
+		return handle;
+	}
+
+	JobHandle JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, std::function<void(uint32_t begin, uint32_t end)> func)
+	{
+		batchSize = std::max(batchSize, 1u);
+
+		// Batches share one copy of the body instead of copying its captures per batch
+		auto body = std::make_shared<std::function<void(uint32_t, uint32_t)>>(std::move(func));
+
+		std::vector<JobHandle> batches;
+		batches.reserve((count + batchSize - 1) / batchSize);
+		for (uint32_t begin = 0; begin < count; begin += batchSize)
+		{
+			uint32_t end = std::min(count, begin + std::min(batchSize, count - begin));
+			batches.push_back(Schedule([body, begin, end]() { (*body)(begin, end); }));
+		}
+
+		return Schedule(nullptr, batches);
+	}
+
+	void JobSystem::Wait(const JobHandle& handle)
+	{
+		if (handle.IsDone())
+			return;
+
+		PS_PROFILE_SCOPE("JobSystem::Wait");
+		while (!handle.IsDone())
+		{
+			Job* job = s_Instance ? s_Instance->FindJob() : nullptr;
+			if (job)
+				Execute(job);
+			else
+				std::this_thread::yield();
+		}
+	}
+
+	void JobSystem::RunOnMainThread(std::function<void()> work)
+	{
+		if (!s_Instance)
+		{
+			work();
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(s_Instance->m_MainThreadMutex);
+		s_Instance->m_MainThreadQueue.push_back(std::move(work));
+		if (s_Instance->m_MainThreadWake)
+			s_Instance->m_MainThreadWake();
+	}
+
+	void JobSystem::DrainMainThreadQueue()
+	{
+		if (!s_Instance)
+			return;
+
+		std::vector<std::function<void()>>& running = s_Instance->m_MainThreadRunning;
+		{
+			std::lock_guard<std::mutex> lock(s_Instance->m_MainThreadMutex);
+			if (s_Instance->m_MainThreadQueue.empty())
+				return;
+			running.swap(s_Instance->m_MainThreadQueue);
+		}
+
+		PS_PROFILE_SCOPE("JobSystem::DrainMainThreadQueue");
+		for (std::function<void()>& work : running)
+			work();
+		running.clear();
+	}
+
+	void JobSystem::SetMainThreadWakeCallback(std::function<void()> callback)
+	{
+		if (!s_Instance)
+			return;
+
+		std::lock_guard<std::mutex> lock(s_Instance->m_MainThreadMutex);
+		s_Instance->m_MainThreadWake = std::move(callback);
+	}
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "pspch.h"
+
+#include <atomic>
+#include <condition_variable>
+
+namespace PulseStudio {
+
+	struct Job;
+
+	// Reference to a scheduled job, cheap to copy
+	class JobHandle
+	{
+	public:
+		JobHandle() = default;
+		explicit JobHandle(Job* job);
+		JobHandle(const JobHandle& other);
+		JobHandle(JobHandle&& other) noexcept;
+		JobHandle& operator=(JobHandle other) noexcept;
+		~JobHandle();
+
+		inline bool IsValid() const { return m_Job != nullptr; }
+		bool IsDone() const;
+
+		// Block until the job has run, executing other jobs meanwhile
+		void Wait() const;
+
+		// Schedule work to run once this job has finished
+		JobHandle Then(std::function<void()> work) const;
+
+		inline Job* GetJob() const { return m_Job; }
+	private:
+		Job* m_Job = nullptr;
+	};
+
+	/*
+	* Worker pool with one work-stealing deque per worker (hardware concurrency - 1 workers, the main
+	* thread helps out whenever it waits). Jobs scheduled from a worker go to its own deque, jobs from
+	* other threads go through a shared injection queue. Idle workers steal from a random victim and
+	* sleep once there is nothing left anywhere.
+	* Jobs can depend on other jobs and carry continuations; a job becomes runnable when its last
+	* dependency finishes. Results that have to be applied on the main thread (layer state, GL
+	* resources through the render thread) are posted with RunOnMainThread and drained once per
+	* frame in Application::Run.
+	*/
+	class JobSystem
+	{
+	public:
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		static inline bool IsInitialized() { return s_Instance != nullptr; }
+		static uint32_t GetWorkerCount();
+
+		// Run work on a worker once every dependency has finished
+		static JobHandle Schedule(std::function<void()> work, std::initializer_list<JobHandle> dependencies = {});
+		static JobHandle Schedule(std::function<void()> work, const std::vector<JobHandle>& dependencies);
+
+		// Split [0, count) into batches of batchSize and run func(begin, end) on each in parallel,
+		// the returned handle finishes with the last batch
+		static JobHandle ParallelFor(uint32_t count, uint32_t batchSize, std::function<void(uint32_t begin, uint32_t end)> func);
+
+		// Block until the job has run, executing other jobs meanwhile
+		static void Wait(const JobHandle& handle);
+
+		// Queue work for the main thread, callable from any thread
+		static void RunOnMainThread(std::function<void()> work);
+		// Run everything posted with RunOnMainThread, main thread only
+		static void DrainMainThreadQueue();
+		// Called after work is posted for the main thread, e.g. to wake up an idle event loop
+		static void SetMainThreadWakeCallback(std::function<void()> callback);
+	private:
+		JobSystem(uint32_t workerCount);
+		~JobSystem();
+
+		void WorkerLoop(uint32_t index);
+		void Enqueue(Job* job);
+		Job* FindJob();
+
+		static void Execute(Job* job);
+		static void FinishJob(Job* job);
+		static void AddDependency(Job* job, Job* dependency);
+		static void ReleaseDependency(Job* job);
+
+		struct Worker;
+		std::vector<std::unique_ptr<Worker>> m_Workers;
+		std::vector<std::thread> m_Threads;
+
+		std::mutex m_InjectionMutex;
+		std::deque<Job*> m_InjectionQueue;
+
+		std::mutex m_SleepMutex;
+		std::condition_variable m_SleepCondition;
+		std::atomic<int64_t> m_QueuedJobs = 0;
+		std::atomic<uint32_t> m_SleepingWorkers = 0;
+		std::atomic<bool> m_Running = true;
+
+		std::mutex m_MainThreadMutex;
+		std::vector<std::function<void()>> m_MainThreadQueue;
+		std::vector<std::function<void()>> m_MainThreadRunning;
+		std::function<void()> m_MainThreadWake;
+
+		static JobSystem* s_Instance;
+		static thread_local Worker* s_CurrentWorker;
+	};
+
+}
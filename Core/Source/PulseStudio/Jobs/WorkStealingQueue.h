@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace PulseStudio {
+
+	/*
+	* Bounded Chase-Lev deque of pointers. The owning thread pushes and pops at the bottom (LIFO, so
+	* it keeps working on what is hot in its cache), any other thread steals from the top (FIFO, the
+	* oldest and usually largest pieces of work). Push/Pop never block; Steal and the last-item Pop
+	* race through a single CAS on the top index.
+	* Memory orderings follow Le, Pop, Cohen, Zappa Nardelli: "Correct and Efficient Work-Stealing
+	* for Weak Memory Models" (PPoPP 2013).
+	*/
+	template<typename T>
+	class WorkStealingQueue
+	{
+	public:
+		// Capacity is rounded up to the next power of two
+		explicit WorkStealingQueue(size_t capacity = 4096)
+		{
+			size_t size = 2;
+			while (size < capacity)
+				size <<= 1;
+
+			m_Mask = (int64_t)size - 1;
+			m_Buffer = std::make_unique<std::atomic<T*>[]>(size);
+		}
+
+		WorkStealingQueue(const WorkStealingQueue&) = delete;
+		WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+		// Owner only, returns false when full
+		bool Push(T* item)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			if (bottom - top > m_Mask)
+				return false;
+
+			m_Buffer[bottom & m_Mask].store(item, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		// Owner only, nullptr when empty
+		T* Pop()
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T* item = m_Buffer[bottom & m_Mask].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last item, a thief may be taking it at the same time
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					item = nullptr;
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return item;
+		}
+
+		// Any thread, nullptr when empty or when another thread won the race
+		T* Steal()
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+			if (top >= bottom)
+				return nullptr;
+
+			T* item = m_Buffer[top & m_Mask].load(std::memory_order_relaxed);
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+			return item;
+		}
+
+		bool IsEmpty() const
+		{
+			return m_Bottom.load(std::memory_order_relaxed) <= m_Top.load(std::memory_order_relaxed);
+		}
+	private:
+		static constexpr size_t s_CacheLine = 64;
+
+		std::unique_ptr<std::atomic<T*>[]> m_Buffer;
+		int64_t m_Mask = 0;
+
+		alignas(s_CacheLine) std::atomic<int64_t> m_Top = 0;
+		alignas(s_CacheLine) std::atomic<int64_t> m_Bottom = 0;
+	};
+
+}
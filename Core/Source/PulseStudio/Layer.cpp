@@ -1,6 +1,8 @@
 #include "pspch.h"
 #include "Layer.h"
 
+#include "Application.h"
+
 namespace PulseStudio {
 
 	Layer::Layer(const std::string& debugName)
@@ -8,5 +10,15 @@ namespace PulseStudio {
 	{
 	}
 
+	void Layer::Invalidate()
+	{
+		Application::Get().Invalidate();
+	}
+
+	void Layer::InvalidateRect(const Rect& rect)
+	{
+		Application::Get().InvalidateRect(rect);
+	}
+
 }
 
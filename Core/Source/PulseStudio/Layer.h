@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Events/Event.h"
+#include "DamageRegion.h"
 
 namespace PulseStudio {
 
@@ -12,12 +13,30 @@ namespace PulseStudio {
 
 		virtual void OnAttach() {}
 		virtual void OnDetach() {}
-		virtual void OnUpdate(float deltaTime) {}
-		virtual void OnEvent(Event& event) {}
+		virtual void OnUpdate(float) {}
+		virtual void OnEvent(Event&) {}
 
 		inline const std::string& GetName() const { return m_DebugName; }
+
+		// Ask for a redraw of the whole window or of a region of it (window coordinates).
+		// In OnDemand render mode nothing is redrawn unless a layer asks, animating layers call
+		// this from OnUpdate to keep frames coming.
+		void Invalidate();
+		void InvalidateRect(const Rect& rect);
+
+		// Event subscription, read by the LayerStack when the layer is pushed, so declare it in the
+		// constructor. A layer receives an event if it matches the category mask or one of the types.
+		inline void SetEventCategories(int categoryMask) { m_EventCategoryMask = categoryMask; }
+		inline void SubscribeEventType(EventType type) { m_EventTypeMask |= 1u << (uint32_t)type; }
+
+		inline bool IsSubscribedTo(EventType type, int categoryFlags) const
+		{
+			return (m_EventCategoryMask & categoryFlags) || (m_EventTypeMask & (1u << (uint32_t)type));
+		}
 	protected:
 		std::string m_DebugName;
+		int m_EventCategoryMask = EventCategoryAll;
+		uint32_t m_EventTypeMask = 0;
 	};
 
 }
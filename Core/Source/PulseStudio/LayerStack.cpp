@@ -1,10 +1,11 @@
 #include "pspch.h"
 #include "LayerStack.h"
 
+#include "Events/EventValue.h"
+
 namespace PulseStudio {
 	LayerStack::LayerStack()
 	{
-		m_LayerInsert = m_Layers.begin();
 	}
 	LayerStack::~LayerStack()
 	{
@@ -14,26 +15,33 @@ namespace PulseStudio {
 
 	void LayerStack::PushLayer(Layer* layer)
 	{
-		m_LayerInsert = m_Layers.emplace(m_LayerInsert, layer);
+		m_Layers.emplace(m_Layers.begin() + m_LayerInsertIndex, layer);
+		m_LayerInsertIndex++;
+		RebuildDispatchLists();
 	}
 	void LayerStack::PushOverlay(Layer* overlay)
 	{
 		m_Layers.emplace_back(overlay);
+		RebuildDispatchLists();
 	}
 	void LayerStack::PopLayer(Layer* layer)
 	{
-		auto it = std::find(m_Layers.begin(), m_Layers.end(), layer);
-		if (it != m_Layers.end())
+		auto it = std::find(m_Layers.begin(), m_Layers.begin() + m_LayerInsertIndex, layer);
+		if (it != m_Layers.begin() + m_LayerInsertIndex)
 		{
 			m_Layers.erase(it);
-			m_LayerInsert--;
+			m_LayerInsertIndex--;
+			RebuildDispatchLists();
 		}
 	}
 	void LayerStack::PopOverlay(Layer* overlay)
 	{
-		auto it = std::find(m_Layers.begin(), m_Layers.end(), overlay);
+		auto it = std::find(m_Layers.begin() + m_LayerInsertIndex, m_Layers.end(), overlay);
 		if (it != m_Layers.end())
+		{
 			m_Layers.erase(it);
+			RebuildDispatchLists();
+		}
 	}
 
 	void LayerStack::Clear()
@@ -41,7 +49,24 @@ namespace PulseStudio {
 		for (Layer* layer : m_Layers)
 			delete layer;
 		m_Layers.clear();
-		m_LayerInsert = m_Layers.begin();
+		m_LayerInsertIndex = 0;
+		RebuildDispatchLists();
+	}
+
+	void LayerStack::RebuildDispatchLists()
+	{
+		for (size_t type = 0; type < EventTypeCount; type++)
+		{
+			std::vector<Layer*>& list = m_DispatchLists[type];
+			list.clear();
+
+			int categoryFlags = GetEventCategoryFlags((EventType)type);
+			for (auto it = m_Layers.rbegin(); it != m_Layers.rend(); ++it)
+			{
+				if ((*it)->IsSubscribedTo((EventType)type, categoryFlags))
+					list.push_back(*it);
+			}
+		}
 	}
 
 }
@@ -19,11 +19,17 @@ namespace PulseStudio {
 
 		void Clear();
 
+		// Layers subscribed to an event type, topmost first
+		inline const std::vector<Layer*>& GetDispatchList(EventType type) const { return m_DispatchLists[(size_t)type]; }
+
 		std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
 		std::vector<Layer*>::iterator end() { return m_Layers.end(); }
 	private:
+		void RebuildDispatchLists();
+
 		std::vector<Layer*> m_Layers;
-		std::vector<Layer*>::iterator m_LayerInsert;
+		unsigned int m_LayerInsertIndex = 0;
+		std::array<std::vector<Layer*>, EventTypeCount> m_DispatchLists;
 	};
 
 }
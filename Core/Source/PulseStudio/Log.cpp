@@ -11,9 +11,19 @@ Logger& Logger::getInstance()
 
 // Constructor
 Logger::Logger()
-    : m_consoleLevel(LogLevel::Debug)  // Changed to show debug by default
+    : m_initialized(false)
+    , m_consoleLevel(LogLevel::Debug)  // Changed to show debug by default
     , m_fileLevel(LogLevel::Debug)
-    , m_initialized(false)
+    , m_binaryOpen(false)
+    , m_binaryLevel(LogLevel::Debug)
+    , m_nextBinaryFormatId(BinaryLog::s_MessageFormatId + 1)
+    , m_lastBinaryTick(0)
+    , m_async(false)
+    , m_writerRunning(false)
+    , m_activeProducers(0)
+    , m_droppedTotal(0)
+    , m_droppedPending(0)
+    , m_overflowPolicy(LogOverflowPolicy::DropAndCount)
 #ifdef _WIN32
     , m_consoleHandle(nullptr)
     , m_consoleColorSupported(false)
@@ -28,7 +38,8 @@ Logger::~Logger()
 }
 
 // Initialize the logger
-void Logger::init(const std::string& logFilePath, LogLevel consoleLevel, LogLevel fileLevel)
+void Logger::init(const std::string& logFilePath, LogLevel consoleLevel, LogLevel fileLevel,
+    const LogRotationSettings& rotation)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
@@ -40,9 +51,20 @@ void Logger::init(const std::string& logFilePath, LogLevel consoleLevel, LogLeve
     m_consoleLevel = consoleLevel;
     m_fileLevel = fileLevel;
 
+    // Anchor the monotonic timestamp base to wall time
+    LogClock::calibrate();
+
     // Open log file
-    m_logFile.open(logFilePath, std::ios::out | std::ios::app);
-    if (!m_logFile.is_open()) 
+    if (rotation.segmentSize > 0)
+    {
+        m_rotatingFile.open(logFilePath, rotation);
+    }
+    else
+    {
+        m_logFile.open(logFilePath, std::ios::out | std::ios::app);
+    }
+
+    if (!isFileOpen()) 
     {
         std::cerr << "Failed to open log file: " << logFilePath << std::endl;
         return;
@@ -59,11 +81,7 @@ void Logger::init(const std::string& logFilePath, LogLevel consoleLevel, LogLeve
 
     std::cout << "\033[32m" << fullMessage << "\033[0m \n";
 
-    if (m_logFile.is_open())
-    {
-        m_logFile << fullMessage << std::endl;
-        m_logFile.flush();
-    }
+    writeToFile(fullMessage + "\n");
 }
 // Set console log level
 void Logger::setConsoleLevel(LogLevel level)
@@ -79,9 +97,84 @@ void Logger::setFileLevel(LogLevel level)
     m_fileLevel = level;
 }
 
+// Set binary log level
+void Logger::setBinaryLevel(LogLevel level)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_binaryLevel = level;
+}
+
+// Open the binary log, each session appends its own header
+bool Logger::openBinaryLog(const std::string& path, LogLevel level)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_binaryFile.is_open())
+    {
+        m_binaryFile.close();
+    }
+
+    m_binaryFile.open(path, std::ios::out | std::ios::app | std::ios::binary);
+    if (!m_binaryFile.is_open())
+    {
+        std::cerr << "Failed to open binary log file: " << path << std::endl;
+        m_binaryOpen = false;
+        return false;
+    }
+
+    // Format ids and tick deltas are scoped to a session
+    m_binaryFormatIds.clear();
+    m_nextBinaryFormatId = BinaryLog::s_MessageFormatId + 1;
+    m_lastBinaryTick = 0;
+
+    using Period = std::chrono::system_clock::period;
+    std::string header;
+    BinaryLog::WriteHeader(header, static_cast<uint64_t>(Period::den / Period::num));
+    m_binaryFile.write(header.data(), header.size());
+
+    m_binaryLevel = level;
+    m_binaryOpen = true;
+    return true;
+}
+
+// Close the binary log
+void Logger::closeBinaryLog()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_binaryOpen = false;
+    if (m_binaryFile.is_open())
+    {
+        m_binaryFile.close();
+    }
+}
+
 // Core logging method
-void Logger::log(LogLevel level, const std::string& message, const std::string& file, int line)
+void Logger::log(LogLevel level, const std::string& message, const std::string&, int)
 {
+    if (!shouldLog(level))
+    {
+        return;
+    }
+
+    PS_MEMORY_TAG(Logger);
+    submit(LogRecord(level, LogClock::now(), message));
+}
+
+// Hand a record to the writer thread, or write it directly in sync mode
+void Logger::submit(LogRecord&& record)
+{
+    // Async path: only move the compact record, the writer thread does the rest
+    // (sequentially consistent so stopWriter() cannot miss an in-flight producer)
+    m_activeProducers.fetch_add(1);
+    if (m_async.load())
+    {
+        enqueue(std::move(record));
+        m_activeProducers.fetch_sub(1);
+        return;
+    }
+    m_activeProducers.fetch_sub(1);
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     if (!m_initialized) 
@@ -89,45 +182,301 @@ void Logger::log(LogLevel level, const std::string& message, const std::string&
         return;
     }
 
-    // Get timestamp
-    std::string timestamp = getTimestamp();
+    // Without a writer thread nothing else follows wall clock adjustments, costs a clock read
+    // and a relaxed load while the calibration is fresh
+    LogClock::calibrateIfStale();
 
-    // Build log message in specified format
-    std::stringstream logMessage;
-    logMessage << "[" << timestamp << "][" << levelToString(level) << "] -> " << message;
+    writeRecords(&record, 1);
+}
 
-    std::string fullMessage = logMessage.str();
+// Check the level against both sinks without taking the lock
+bool Logger::shouldLog(LogLevel level) const
+{
+    if (!m_initialized.load(std::memory_order_acquire))
+    {
+        return false;
+    }
 
-    // Output to console if level is sufficient
-    if (static_cast<int>(level) >= static_cast<int>(m_consoleLevel))
+    return static_cast<int>(level) >= static_cast<int>(m_consoleLevel.load(std::memory_order_relaxed))
+        || static_cast<int>(level) >= static_cast<int>(m_fileLevel.load(std::memory_order_relaxed))
+        || (m_binaryOpen.load(std::memory_order_relaxed)
+            && static_cast<int>(level) >= static_cast<int>(m_binaryLevel.load(std::memory_order_relaxed)));
+}
+
+// Push a record into the ring buffer according to the overflow policy
+void Logger::enqueue(LogRecord&& record)
+{
+    bool urgent = static_cast<int>(record.level) >= static_cast<int>(LogLevel::Error);
+
+    while (!m_queue->tryPush(std::move(record)))
     {
-#ifdef _WIN32
-        if (m_consoleColorSupported)
+        if (m_overflowPolicy == LogOverflowPolicy::Block)
+        {
+            m_writerCondition.notify_one();
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (m_overflowPolicy == LogOverflowPolicy::DropAndCount)
+        {
+            m_droppedPending.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_droppedTotal.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // The writer polls on a short timeout, only wake it early when it matters
+    if (urgent || m_queue->sizeApprox() >= m_queue->capacity() / 2)
+    {
+        m_writerCondition.notify_one();
+    }
+}
+
+// Write a batch of records to the console and file (m_mutex must be held)
+void Logger::writeRecords(const LogRecord* records, size_t count)
+{
+    LogLevel consoleLevel = m_consoleLevel.load(std::memory_order_relaxed);
+    LogLevel fileLevel = m_fileLevel.load(std::memory_order_relaxed);
+    LogLevel binaryLevel = m_binaryLevel.load(std::memory_order_relaxed);
+    bool binaryOpen = m_binaryFile.is_open();
+
+    std::string consoleBuffer;
+    std::string fileBuffer;
+    std::string binaryBuffer;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const LogRecord& record = records[i];
+
+        // The binary sink never formats, it only packs the captured arguments
+        if (binaryOpen && static_cast<int>(record.level) >= static_cast<int>(binaryLevel))
         {
-            // Set console color
-            std::cout << getConsoleColor(level);
-            std::cout << fullMessage << std::endl;
-            std::cout << getResetColor();
+            encodeBinaryRecord(record, binaryBuffer);
         }
-        else 
+
+        bool toConsole = static_cast<int>(record.level) >= static_cast<int>(consoleLevel);
+        bool toFile = static_cast<int>(record.level) >= static_cast<int>(fileLevel) && isFileOpen();
+        if (!toConsole && !toFile)
         {
-            std::cout << fullMessage << std::endl;
+            continue;
         }
+
+        // Build log message in specified format
+        std::string fullMessage;
+        fullMessage.reserve(64 + record.message.size());
+        fullMessage += '[';
+        LogClock::appendTimestamp(record.time, fullMessage);
+        fullMessage += "][";
+        fullMessage += levelToString(record.level);
+        fullMessage += "] -> ";
+        record.appendMessage(fullMessage);
+
+        // Output to console if level is sufficient
+        if (toConsole)
+        {
+#ifdef _WIN32
+            if (m_consoleColorSupported)
+            {
+                consoleBuffer += getConsoleColor(record.level);
+                consoleBuffer += fullMessage;
+                consoleBuffer += '\n';
+                consoleBuffer += getResetColor();
+            }
+            else
+            {
+                consoleBuffer += fullMessage;
+                consoleBuffer += '\n';
+            }
 #else
-        // Linux/macOS use ANSI color codes
-        std::cout << getConsoleColor(level)
-            << fullMessage
-            << getResetColor()
-            << std::endl;
+            // Linux/macOS use ANSI color codes
+            consoleBuffer += getConsoleColor(record.level);
+            consoleBuffer += fullMessage;
+            consoleBuffer += getResetColor();
+            consoleBuffer += '\n';
 #endif
+        }
+
+        // Output to file if level is sufficient
+        if (toFile)
+        {
+            fileBuffer += fullMessage;
+            fileBuffer += '\n';
+        }
+    }
+
+    if (!consoleBuffer.empty())
+    {
+        std::cout.write(consoleBuffer.data(), consoleBuffer.size());
+        std::cout.flush();
     }
 
-    // Output to file if level is sufficient
-    if (static_cast<int>(level) >= static_cast<int>(m_fileLevel) && m_logFile.is_open()) 
+    if (!fileBuffer.empty())
     {
-        m_logFile << fullMessage << std::endl;
-        m_logFile.flush(); // Ensure immediate write
+        writeToFile(fileBuffer);
     }
+
+    if (!binaryBuffer.empty())
+    {
+        m_binaryFile.write(binaryBuffer.data(), binaryBuffer.size());
+        m_binaryFile.flush();
+    }
+}
+
+// Write finished text to whichever file sink is open (m_mutex must be held)
+void Logger::writeToFile(const std::string& text)
+{
+    if (m_rotatingFile.isOpen())
+    {
+        // Mapped segment, no flush needed
+        m_rotatingFile.write(text.data(), text.size());
+    }
+    else if (m_logFile.is_open())
+    {
+        m_logFile.write(text.data(), text.size());
+        m_logFile.flush(); // One flush per batch
+    }
+}
+
+bool Logger::isFileOpen() const
+{
+    return m_rotatingFile.isOpen() || m_logFile.is_open();
+}
+
+// Append the binary encoding of a record, defining its format string on first use (m_mutex must be held)
+void Logger::encodeBinaryRecord(const LogRecord& record, std::string& out)
+{
+    uint32_t formatId = BinaryLog::s_MessageFormatId;
+
+    std::string_view format = record.formatString();
+    if (!format.empty())
+    {
+        auto [it, inserted] = m_binaryFormatIds.try_emplace(format, m_nextBinaryFormatId);
+        if (inserted)
+        {
+            ++m_nextBinaryFormatId;
+            out += static_cast<char>(BinaryLog::RecordKind::FormatDef);
+            BinaryLog::WriteVarint(out, it->second);
+            BinaryLog::WriteString(out, format);
+        }
+        formatId = it->second;
+    }
+
+    int64_t tick = static_cast<int64_t>(record.time.time_since_epoch().count());
+
+    out += static_cast<char>(BinaryLog::RecordKind::Entry);
+    out += static_cast<char>(record.level);
+    BinaryLog::WriteVarint(out, formatId);
+    BinaryLog::WriteZigzag(out, tick - m_lastBinaryTick);
+    BinaryLog::WriteVarint(out, record.threadId);
+    record.appendBinaryArgs(out);
+
+    m_lastBinaryTick = tick;
+}
+
+// Switch to async mode
+void Logger::enableAsync(size_t queueCapacity, LogOverflowPolicy policy)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_async.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    m_overflowPolicy = policy;
+    m_queue = std::make_unique<LogRingBuffer<LogRecord>>(queueCapacity);
+    m_writerRunning.store(true, std::memory_order_release);
+    m_writerThread = std::thread(&Logger::writerLoop, this);
+    m_async.store(true, std::memory_order_release);
+}
+
+// Drain the queue and return to synchronous logging
+void Logger::disableAsync()
+{
+    stopWriter();
+}
+
+// Writer thread main loop
+void Logger::writerLoop()
+{
+    PS_MEMORY_TAG(Logger);
+
+    constexpr size_t batchSize = 256;
+    std::vector<LogRecord> batch(batchSize);
+
+    for (;;)
+    {
+        // Read the flag before draining so nothing pushed before the stop request is lost
+        bool running = m_writerRunning.load(std::memory_order_acquire);
+
+        size_t count = 0;
+        while (count < batchSize && m_queue->tryPop(batch[count]))
+        {
+            ++count;
+        }
+
+        // Follow wall clock adjustments (NTP, DST) without touching the producers
+        LogClock::calibrateIfStale();
+
+        if (count > 0 || m_droppedPending.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            writeRecords(batch.data(), count);
+            reportDropped();
+        }
+
+        if (count == batchSize)
+        {
+            continue;
+        }
+
+        if (!running)
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(m_writerMutex);
+        m_writerCondition.wait_for(lock, std::chrono::milliseconds(10));
+    }
+}
+
+// Report messages dropped since the last report (m_mutex must be held)
+void Logger::reportDropped()
+{
+    uint64_t dropped = m_droppedPending.exchange(0, std::memory_order_relaxed);
+    if (dropped == 0)
+    {
+        return;
+    }
+
+    LogRecord record(LogLevel::Warn, LogClock::now());
+    record.capture("Log queue full, dropped {0} message(s).", dropped);
+    writeRecords(&record, 1);
+}
+
+// Stop the writer thread after draining everything that was queued
+void Logger::stopWriter()
+{
+    if (!m_async.exchange(false))
+    {
+        return;
+    }
+
+    // Wait for producers that already took the async path to finish pushing
+    while (m_activeProducers.load() != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    m_writerRunning.store(false, std::memory_order_release);
+    m_writerCondition.notify_one();
+
+    if (m_writerThread.joinable())
+    {
+        m_writerThread.join();
+    }
+
+    m_queue.reset();
 }
 
 // Convenience logging methods
@@ -164,6 +513,9 @@ void Logger::fatal(const std::string& message, const std::string& file, int line
 // Shutdown the logger
 void Logger::shutdown()
 {
+    // Guaranteed drain: everything queued before shutdown reaches the sinks
+    stopWriter();
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     if (m_initialized) 
@@ -174,36 +526,34 @@ void Logger::shutdown()
 
         std::cout << fullMessage << std::endl;
 
+        writeToFile(fullMessage + "\n");
+
         if (m_logFile.is_open())
         {
-            m_logFile << fullMessage << std::endl;
+            m_logFile.close();
         }
+        m_rotatingFile.close();
 
-        if (m_logFile.is_open())
+        m_binaryOpen = false;
+        if (m_binaryFile.is_open())
         {
-            m_logFile.close();
+            m_binaryFile.close();
         }
 
         m_initialized = false;
     }
 }
 
-// Get current timestamp in specified format
-std::string Logger::getTimestamp() 
+// Get timestamp in specified format
+std::string Logger::getTimestamp(LogClock::TimePoint now) 
 {
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-
-    std::stringstream ss;
-    ss << std::put_time(std::localtime(&time), "%Y/%m/%d %H:%M:%S")
-        << '.' << std::setfill('0') << std::setw(3) << ms.count();
-
-    return ss.str();
+    std::string timestamp;
+    LogClock::appendTimestamp(now, timestamp);
+    return timestamp;
 }
 
 // Convert log level to string with first letter capitalized
-std::string Logger::levelToString(LogLevel level) 
+const char* Logger::levelToString(LogLevel level) 
 {
     switch (level) 
     {
@@ -218,7 +568,7 @@ std::string Logger::levelToString(LogLevel level)
 }
 
 // Get console color code for log level
-std::string Logger::getConsoleColor(LogLevel level) 
+const char* Logger::getConsoleColor(LogLevel level) 
 {
     switch (level) 
     {
@@ -233,7 +583,7 @@ std::string Logger::getConsoleColor(LogLevel level)
 }
 
 // Reset console color
-std::string Logger::getResetColor()
+const char* Logger::getResetColor()
 {
     return "\033[0m";
 }
@@ -2,6 +2,19 @@
 
 #include "pspch.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <format>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "LogRingBuffer.h"
+#include "BinaryLogFormat.h"
+#include "RotatingLogFile.h"
+#include "LogClock.h"
+#include "Memory/AllocationTracker.h"
+
 // Platform-specific console color codes
 #ifdef _WIN32
 #include <windows.h>
@@ -18,6 +31,250 @@ enum class LogLevel
     Fatal
 };
 
+// Numeric values of LogLevel, usable in preprocessor conditions
+#define PS_LOG_LEVEL_DEBUG 0
+#define PS_LOG_LEVEL_TRACE 1
+#define PS_LOG_LEVEL_INFO  2
+#define PS_LOG_LEVEL_WARN  3
+#define PS_LOG_LEVEL_ERROR 4
+#define PS_LOG_LEVEL_FATAL 5
+
+// Calls below this level are compiled out entirely (Debug/Trace are stripped in Dist)
+#ifndef PS_MIN_LOG_LEVEL
+    #ifdef DIST
+        #define PS_MIN_LOG_LEVEL PS_LOG_LEVEL_INFO
+    #else
+        #define PS_MIN_LOG_LEVEL PS_LOG_LEVEL_DEBUG
+    #endif
+#endif
+
+// What the async logger does when its ring buffer is full
+enum class LogOverflowPolicy
+{
+    Block,          // Wait for the writer thread to make room
+    Drop,           // Silently discard the message
+    DropAndCount    // Discard the message and report the count from the writer thread
+};
+
+// How a format argument is stored until the record is formatted. Pointers to
+// characters and string views may dangle by then, so the record owns a copy.
+template<typename T>
+using LogArgStorage = std::conditional_t<
+    std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*> ||
+    std::is_same_v<std::decay_t<T>, std::string_view>,
+    std::string, std::decay_t<T>>;
+
+// Small sequential id of the calling thread, stable for the thread's lifetime
+inline uint32_t getLogThreadId()
+{
+    static std::atomic<uint32_t> s_nextId{ 1 };
+    thread_local uint32_t id = s_nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+// Append one type-tagged argument in the binary log encoding
+template<typename T>
+void encodeLogArg(std::string& out, const T& value)
+{
+    using BinaryLog::ArgType;
+
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        out += static_cast<char>(ArgType::Bool);
+        out += static_cast<char>(value ? 1 : 0);
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        out += static_cast<char>(ArgType::Char);
+        out += value;
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+        out += static_cast<char>(ArgType::Int);
+        BinaryLog::WriteZigzag(out, static_cast<int64_t>(value));
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        out += static_cast<char>(ArgType::UInt);
+        BinaryLog::WriteVarint(out, static_cast<uint64_t>(value));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        double number = static_cast<double>(value);
+        out += static_cast<char>(ArgType::Double);
+        BinaryLog::WriteRaw(out, &number, sizeof(number));
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        out += static_cast<char>(ArgType::String);
+        BinaryLog::WriteString(out, value);
+    }
+    else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>)
+    {
+        out += static_cast<char>(ArgType::Pointer);
+        BinaryLog::WriteVarint(out, reinterpret_cast<uintptr_t>(static_cast<const void*>(value)));
+    }
+    else
+    {
+        // Types with a custom formatter are stored as their default text
+        out += static_cast<char>(ArgType::String);
+        BinaryLog::WriteString(out, std::format("{}", value));
+    }
+}
+
+// Compact record handed from producers to the writer thread.
+// Either holds a finished message, or a compile-time checked format string
+// plus its arguments captured by value into a fixed-size inline payload.
+struct LogRecord
+{
+    static constexpr size_t s_payloadSize = 96;
+
+    LogRecord() = default;
+    LogRecord(LogLevel level, std::chrono::system_clock::time_point time, std::string message = {})
+        : level(level), time(time), threadId(getLogThreadId()), message(std::move(message))
+    {
+    }
+    LogRecord(LogRecord&& other) noexcept { moveFrom(other); }
+    LogRecord& operator=(LogRecord&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+    ~LogRecord() { reset(); }
+
+    // Capture the arguments for deferred formatting, or format eagerly if they do not fit
+    template<typename... Args>
+    void capture(std::string_view format, Args&&... args)
+    {
+        using Payload = std::tuple<LogArgStorage<Args>...>;
+
+        if constexpr (sizeof(Payload) <= s_payloadSize && alignof(Payload) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<Payload>)
+        {
+            reset();
+            new (m_payload) Payload(std::forward<Args>(args)...);
+            m_ops = &s_payloadOps<Payload>;
+            m_format = format;
+        }
+        else
+        {
+            message = std::vformat(format, std::make_format_args(args...));
+        }
+    }
+
+    // Append the final message text to out
+    void appendMessage(std::string& out) const
+    {
+        if (m_ops)
+        {
+            m_ops->format(m_payload, m_format, out);
+        }
+        else
+        {
+            out += message;
+        }
+    }
+
+    // Append the argument count and type-tagged arguments for the binary sink
+    void appendBinaryArgs(std::string& out) const
+    {
+        if (m_ops)
+        {
+            m_ops->encode(m_payload, out);
+        }
+        else
+        {
+            out += static_cast<char>(1);
+            encodeLogArg(out, message);
+        }
+    }
+
+    // Format string of a deferred record, empty for prebuilt messages
+    std::string_view formatString() const { return m_ops ? m_format : std::string_view(); }
+
+    LogLevel level = LogLevel::Info;
+    std::chrono::system_clock::time_point time;
+    uint32_t threadId = 0;
+    std::string message;
+private:
+    struct PayloadOps
+    {
+        void (*format)(const void* payload, std::string_view format, std::string& out);
+        void (*encode)(const void* payload, std::string& out);
+        void (*move)(void* destination, void* source);
+        void (*destroy)(void* payload);
+    };
+
+    template<typename Payload>
+    static constexpr PayloadOps s_payloadOps =
+    {
+        [](const void* payload, std::string_view format, std::string& out)
+        {
+            try
+            {
+                std::apply([&](const auto&... args)
+                    {
+                        std::vformat_to(std::back_inserter(out), format, std::make_format_args(args...));
+                    }, *static_cast<const Payload*>(payload));
+            }
+            catch (const std::format_error& ex)
+            {
+                out += "<format error: ";
+                out += ex.what();
+                out += '>';
+            }
+        },
+        [](const void* payload, std::string& out)
+        {
+            out += static_cast<char>(std::tuple_size_v<Payload>);
+            std::apply([&](const auto&... args)
+                {
+                    (encodeLogArg(out, args), ...);
+                }, *static_cast<const Payload*>(payload));
+        },
+        [](void* destination, void* source)
+        {
+            new (destination) Payload(std::move(*static_cast<Payload*>(source)));
+        },
+        [](void* payload)
+        {
+            static_cast<Payload*>(payload)->~Payload();
+        }
+    };
+
+    void moveFrom(LogRecord& other) noexcept
+    {
+        level = other.level;
+        time = other.time;
+        threadId = other.threadId;
+        message = std::move(other.message);
+        m_format = other.m_format;
+        m_ops = other.m_ops;
+        if (m_ops)
+        {
+            m_ops->move(m_payload, other.m_payload);
+            other.reset();
+        }
+    }
+
+    void reset() noexcept
+    {
+        if (m_ops)
+        {
+            m_ops->destroy(m_payload);
+            m_ops = nullptr;
+        }
+    }
+
+    const PayloadOps* m_ops = nullptr;
+    std::string_view m_format;
+    alignas(std::max_align_t) unsigned char m_payload[s_payloadSize];
+};
+
 // Logger singleton class
 class Logger 
 {
@@ -25,19 +282,58 @@ public:
     // Get singleton instance
     static Logger& getInstance();
 
-    // Initialize the logger
+    // Initialize the logger, a non-zero rotation segment size writes the
+    // text log through rotating memory-mapped segments instead of a stream
     void init(const std::string& logFilePath = "Logs/PulseStudioLog.log",
         LogLevel consoleLevel = LogLevel::Debug,  // Changed to show debug by default
-        LogLevel fileLevel = LogLevel::Debug);
+        LogLevel fileLevel = LogLevel::Debug,
+        const LogRotationSettings& rotation = LogRotationSettings());
 
     // Set log levels
     void setConsoleLevel(LogLevel level);
     void setFileLevel(LogLevel level);
+    void setBinaryLevel(LogLevel level);
+
+    // Open an additional compact binary log, turn it back into text with the LogDecode tool
+    bool openBinaryLog(const std::string& path, LogLevel level = LogLevel::Debug);
+    void closeBinaryLog();
+
+    // Switch to async mode: producers push into a bounded ring buffer and a
+    // dedicated writer thread formats and writes the records in batches
+    void enableAsync(size_t queueCapacity = 8192,
+        LogOverflowPolicy policy = LogOverflowPolicy::DropAndCount);
+
+    // Drain the queue and return to synchronous logging
+    void disableAsync();
+
+    bool isAsync() const { return m_async.load(std::memory_order_acquire); }
+
+    // Number of messages discarded because the ring buffer was full
+    uint64_t getDroppedCount() const { return m_droppedTotal.load(std::memory_order_relaxed); }
+
+    // Check the level against both sinks without taking the lock
+    bool shouldLog(LogLevel level) const;
 
     // Logging methods
     void log(LogLevel level, const std::string& message,
         const std::string& file = "", int line = -1);
 
+    // Deferred-format logging: the level is checked first, the arguments are
+    // captured by value and only formatted when the record is written
+    template<typename... Args>
+    void logFormat(LogLevel level, std::format_string<Args...> format, Args&&... args)
+    {
+        if (!shouldLog(level))
+        {
+            return;
+        }
+
+        PS_MEMORY_TAG(Logger);
+        LogRecord record(level, LogClock::now());
+        record.capture(format.get(), std::forward<Args>(args)...);
+        submit(std::move(record));
+    }
+
     // Convenience logging methods
     void debug(const std::string& message, const std::string& file = "", int line = -1);
     void trace(const std::string& message, const std::string& file = "", int line = -1);
@@ -57,62 +353,132 @@ private:
     Logger();
     ~Logger();
 
-    // Get current timestamp in specified format
-    std::string getTimestamp();
+    // Hand a record to the writer thread, or write it directly in sync mode
+    void submit(LogRecord&& record);
+
+    // Push a record into the ring buffer according to the overflow policy
+    void enqueue(LogRecord&& record);
+
+    // Writer thread main loop
+    void writerLoop();
+
+    // Write a batch of records to the console and file (m_mutex must be held)
+    void writeRecords(const LogRecord* records, size_t count);
+
+    // Write finished text to whichever file sink is open (m_mutex must be held)
+    void writeToFile(const std::string& text);
+    bool isFileOpen() const;
+
+    // Append the binary encoding of a record, defining its format string on first use (m_mutex must be held)
+    void encodeBinaryRecord(const LogRecord& record, std::string& out);
+
+    // Report messages dropped since the last report (m_mutex must be held)
+    void reportDropped();
+
+    // Stop the writer thread after draining everything that was queued
+    void stopWriter();
+
+    // Get timestamp in specified format
+    std::string getTimestamp(LogClock::TimePoint time = LogClock::now());
 
     // Convert log level to string with first letter capitalized
-    std::string levelToString(LogLevel level);
+    const char* levelToString(LogLevel level);
 
     // Get console color code for log level
-    std::string getConsoleColor(LogLevel level);
+    const char* getConsoleColor(LogLevel level);
 
     // Reset console color
-    std::string getResetColor();
+    const char* getResetColor();
 
     // Initialize console color support (Windows)
     void initConsoleColor();
 
     // Member variables
-    bool m_initialized;
+    std::atomic<bool> m_initialized;
     std::ofstream m_logFile;
-    LogLevel m_consoleLevel;
-    LogLevel m_fileLevel;
+    RotatingLogFile m_rotatingFile;
+    std::atomic<LogLevel> m_consoleLevel;
+    std::atomic<LogLevel> m_fileLevel;
     std::mutex m_mutex;
 
+    // Binary sink
+    std::ofstream m_binaryFile;
+    std::atomic<bool> m_binaryOpen;
+    std::atomic<LogLevel> m_binaryLevel;
+    std::unordered_map<std::string_view, uint32_t> m_binaryFormatIds;
+    uint32_t m_nextBinaryFormatId;
+    int64_t m_lastBinaryTick;
+
+    // Async mode
+    std::atomic<bool> m_async;
+    std::atomic<bool> m_writerRunning;
+    std::atomic<uint32_t> m_activeProducers;
+    std::atomic<uint64_t> m_droppedTotal;
+    std::atomic<uint64_t> m_droppedPending;
+    LogOverflowPolicy m_overflowPolicy;
+    std::unique_ptr<LogRingBuffer<LogRecord>> m_queue;
+    std::thread m_writerThread;
+    std::mutex m_writerMutex;
+    std::condition_variable m_writerCondition;
+
 #ifdef _WIN32
     HANDLE m_consoleHandle;
     bool m_consoleColorSupported;
 #endif
 };
 
+// Level-checked formatted logging. The level must be a constant expression:
+// anything below PS_MIN_LOG_LEVEL compiles to nothing, everything else is
+// checked at runtime before any argument is evaluated.
+#define PS_LOG(level, format, ...) \
+    do \
+    { \
+        if constexpr (static_cast<int>(level) >= PS_MIN_LOG_LEVEL) \
+        { \
+            if (::Logger::getInstance().shouldLog(level)) \
+                ::Logger::getInstance().logFormat(level, format __VA_OPT__(,) __VA_ARGS__); \
+        } \
+    } while (0)
+
+// Level-checked logging of a prebuilt message, msg is only evaluated if the level is enabled
+#define PS_LOG_MESSAGE(level, msg) \
+    do \
+    { \
+        if constexpr (static_cast<int>(level) >= PS_MIN_LOG_LEVEL) \
+        { \
+            if (::Logger::getInstance().shouldLog(level)) \
+                ::Logger::getInstance().log(level, msg, __FILE__, __LINE__); \
+        } \
+    } while (0)
+
 // Client logging macros
-#define LOG_DEBUG(msg) Logger::getInstance().debug(msg, __FILE__, __LINE__)
-#define LOG_TRACE(msg) Logger::getInstance().trace(msg, __FILE__, __LINE__)
-#define LOG_INFO(msg) Logger::getInstance().info(msg, __FILE__, __LINE__)
-#define LOG_WARN(msg) Logger::getInstance().warn(msg, __FILE__, __LINE__)
-#define LOG_ERROR(msg) Logger::getInstance().error(msg, __FILE__, __LINE__)
-#define LOG_FATAL(msg) Logger::getInstance().fatal(msg, __FILE__, __LINE__)
+#define LOG_DEBUG(msg) PS_LOG_MESSAGE(LogLevel::Debug, msg)
+#define LOG_TRACE(msg) PS_LOG_MESSAGE(LogLevel::Trace, msg)
+#define LOG_INFO(msg) PS_LOG_MESSAGE(LogLevel::Info, msg)
+#define LOG_WARN(msg) PS_LOG_MESSAGE(LogLevel::Warn, msg)
+#define LOG_ERROR(msg) PS_LOG_MESSAGE(LogLevel::Error, msg)
+#define LOG_FATAL(msg) PS_LOG_MESSAGE(LogLevel::Fatal, msg)
 
 // Core logging macros
-#define LOG_CORE_DEBUG(msg) Logger::getInstance().debug(msg, __FILE__, __LINE__)
-#define LOG_CORE_TRACE(msg) Logger::getInstance().trace(msg, __FILE__, __LINE__)
-#define LOG_CORE_INFO(msg) Logger::getInstance().info(msg, __FILE__, __LINE__)
-#define LOG_CORE_WARN(msg) Logger::getInstance().warn(msg, __FILE__, __LINE__)
-#define LOG_CORE_ERROR(msg) Logger::getInstance().error(msg, __FILE__, __LINE__)
-#define LOG_CORE_FATAL(msg) Logger::getInstance().fatal(msg, __FILE__, __LINE__)
-
-// VariPS macros for formatted logging (using fmt library)
-#define PS_DEBUG(msg) Logger::getInstance().debug(msg, __FILE__, __LINE__)
-#define PS_TRACE(msg) Logger::getInstance().trace(msg, __FILE__, __LINE__)
-#define PS_INFO(msg) Logger::getInstance().info(msg, __FILE__, __LINE__)
-#define PS_WARN(msg) Logger::getInstance().warn(msg, __FILE__, __LINE__)
-#define PS_ERROR(msg) Logger::getInstance().error(msg, __FILE__, __LINE__)
-#define PS_FATAL(msg) Logger::getInstance().fatal(msg, __FILE__, __LINE__)
-
-// VariPS_Core macros for formatted logging (using fmt library)
-#define PS_CORE_FATAL(...) Logger::getInstance().fatal(__VA_ARGS__)
-#define PS_CORE_ERROR(...) Logger::getInstance().error(__VA_ARGS__)
-#define PS_CORE_WARN(...) Logger::getInstance().warn(__VA_ARGS__)
-#define PS_CORE_INFO(...) Logger::getInstance().info(__VA_ARGS__)
-#define PS_CORE_TRACE(...) Logger::getInstance().trace(__VA_ARGS__)
-#define PS_CORE_DEBUG(...) Logger::getInstance().debug(__VA_ARGS__)
+#define LOG_CORE_DEBUG(msg) PS_LOG_MESSAGE(LogLevel::Debug, msg)
+#define LOG_CORE_TRACE(msg) PS_LOG_MESSAGE(LogLevel::Trace, msg)
+#define LOG_CORE_INFO(msg) PS_LOG_MESSAGE(LogLevel::Info, msg)
+#define LOG_CORE_WARN(msg) PS_LOG_MESSAGE(LogLevel::Warn, msg)
+#define LOG_CORE_ERROR(msg) PS_LOG_MESSAGE(LogLevel::Error, msg)
+#define LOG_CORE_FATAL(msg) PS_LOG_MESSAGE(LogLevel::Fatal, msg)
+
+// VariPS macros for formatted logging (format string + arguments, see PS_LOG)
+#define PS_DEBUG(...) PS_LOG(LogLevel::Debug, __VA_ARGS__)
+#define PS_TRACE(...) PS_LOG(LogLevel::Trace, __VA_ARGS__)
+#define PS_INFO(...) PS_LOG(LogLevel::Info, __VA_ARGS__)
+#define PS_WARN(...) PS_LOG(LogLevel::Warn, __VA_ARGS__)
+#define PS_ERROR(...) PS_LOG(LogLevel::Error, __VA_ARGS__)
+#define PS_FATAL(...) PS_LOG(LogLevel::Fatal, __VA_ARGS__)
+
+// VariPS_Core macros for formatted logging (format string + arguments, see PS_LOG)
+#define PS_CORE_FATAL(...) PS_LOG(LogLevel::Fatal, __VA_ARGS__)
+#define PS_CORE_ERROR(...) PS_LOG(LogLevel::Error, __VA_ARGS__)
+#define PS_CORE_WARN(...) PS_LOG(LogLevel::Warn, __VA_ARGS__)
+#define PS_CORE_INFO(...) PS_LOG(LogLevel::Info, __VA_ARGS__)
+#define PS_CORE_TRACE(...) PS_LOG(LogLevel::Trace, __VA_ARGS__)
+#define PS_CORE_DEBUG(...) PS_LOG(LogLevel::Debug, __VA_ARGS__)
@@ -0,0 +1,90 @@
+#include "pspch.h"
+
+#include "LogClock.h"
+
+#include <cstring>
+#include <ctime>
+
+// Offset of system_clock relative to steady_clock, in system_clock ticks
+std::atomic<std::chrono::system_clock::rep> LogClock::s_offset{ 0 };
+std::atomic<std::chrono::steady_clock::rep> LogClock::s_lastCalibration{ 0 };
+
+// Re-measure the steady-to-wall offset
+void LogClock::calibrate()
+{
+    // Take the tightest bracket of a few samples to keep the error well below 1ms
+    auto bestSpan = std::chrono::steady_clock::duration::max();
+    std::chrono::system_clock::rep offset = 0;
+    std::chrono::steady_clock::time_point last;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        auto before = std::chrono::steady_clock::now();
+        auto wall = std::chrono::system_clock::now();
+        auto after = std::chrono::steady_clock::now();
+
+        if (after - before < bestSpan)
+        {
+            bestSpan = after - before;
+            auto steady = std::chrono::duration_cast<std::chrono::system_clock::duration>((before + (after - before) / 2).time_since_epoch());
+            offset = (wall.time_since_epoch() - steady).count();
+        }
+        last = after;
+    }
+
+    s_offset.store(offset, std::memory_order_relaxed);
+    s_lastCalibration.store(last.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+// Calibrate if the last calibration is older than the interval
+void LogClock::calibrateIfStale(std::chrono::seconds interval)
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    auto last = std::chrono::steady_clock::duration(s_lastCalibration.load(std::memory_order_relaxed));
+    if (now - last >= interval)
+    {
+        calibrate();
+    }
+}
+
+// Append "YYYY/MM/DD HH:MM:SS.mmm" in local time
+void LogClock::appendTimestamp(TimePoint time, std::string& out)
+{
+    struct SecondCache
+    {
+        int64_t second = INT64_MIN;
+        char prefix[20] = {};
+    };
+    thread_local SecondCache cache;
+
+    auto sinceEpoch = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch());
+    int64_t second = sinceEpoch.count() / 1000;
+    int64_t ms = sinceEpoch.count() % 1000;
+    if (ms < 0)
+    {
+        ms += 1000;
+        --second;
+    }
+
+    // Only the slow path touches the C time API, once per second per thread
+    if (second != cache.second)
+    {
+        std::time_t seconds = (std::time_t)second;
+        std::tm local{};
+#ifdef _WIN32
+        localtime_s(&local, &seconds);
+#else
+        localtime_r(&seconds, &local);
+#endif
+        std::strftime(cache.prefix, sizeof(cache.prefix), "%Y/%m/%d %H:%M:%S", &local);
+        cache.second = second;
+    }
+
+    char buffer[s_timestampLength];
+    std::memcpy(buffer, cache.prefix, 19);
+    buffer[19] = '.';
+    buffer[20] = (char)('0' + ms / 100);
+    buffer[21] = (char)('0' + ms / 10 % 10);
+    buffer[22] = (char)('0' + ms % 10);
+    out.append(buffer, s_timestampLength);
+}
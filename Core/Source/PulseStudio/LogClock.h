@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Timestamp service for the logger hot path.
+// Wall time is derived from steady_clock plus an offset calibrated against
+// system_clock, so taking a timestamp is one monotonic clock read. Formatting
+// caches the "YYYY/MM/DD HH:MM:SS" prefix per thread and only patches the
+// millisecond digits unless the second changed.
+class LogClock
+{
+public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    // Length of "YYYY/MM/DD HH:MM:SS.mmm"
+    static constexpr size_t s_timestampLength = 23;
+
+    // Current wall time from the calibrated monotonic base
+    static TimePoint now()
+    {
+        auto steady = std::chrono::steady_clock::now().time_since_epoch();
+        auto wall = std::chrono::duration_cast<std::chrono::system_clock::duration>(steady)
+            + std::chrono::system_clock::duration(s_offset.load(std::memory_order_relaxed));
+        return TimePoint(wall);
+    }
+
+    // Re-measure the steady-to-wall offset, picks up wall clock adjustments
+    static void calibrate();
+
+    // Calibrate if the last calibration is older than the interval (async writer thread, or the
+    // synchronous write path)
+    static void calibrateIfStale(std::chrono::seconds interval = std::chrono::seconds(60));
+
+    // Append "YYYY/MM/DD HH:MM:SS.mmm" in local time
+    static void appendTimestamp(TimePoint time, std::string& out);
+private:
+    static std::atomic<std::chrono::system_clock::rep> s_offset;
+    static std::atomic<std::chrono::steady_clock::rep> s_lastCalibration;
+};
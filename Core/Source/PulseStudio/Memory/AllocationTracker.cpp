@@ -0,0 +1,245 @@
+#include "pspch.h"
+#include "AllocationTracker.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace PulseStudio {
+
+	// Plain counters only: they are touched from operator new, possibly before any constructor ran
+	struct TagCounters
+	{
+		std::atomic<int64_t> LiveBytes;
+		std::atomic<int64_t> LiveCount;
+		std::atomic<int64_t> PeakBytes;
+		std::atomic<uint64_t> TotalAllocations;
+		std::atomic<uint64_t> TotalBytes;
+	};
+
+	static constexpr size_t s_TagCount = (size_t)MemoryTag::Count;
+
+	static TagCounters s_Counters[s_TagCount];
+	static std::atomic<int64_t> s_TotalLiveBytes;
+	static std::atomic<int64_t> s_TotalPeakBytes;
+
+	static int64_t s_BaselineBytes[s_TagCount];
+	static int64_t s_BaselineCount[s_TagCount];
+
+	static thread_local MemoryTag t_CurrentTag = MemoryTag::Untagged;
+
+	const char* MemoryTagToString(MemoryTag tag)
+	{
+		switch (tag)
+		{
+		case MemoryTag::Untagged: return "Untagged";
+		case MemoryTag::Logger:   return "Logger";
+		case MemoryTag::Events:   return "Events";
+		case MemoryTag::Layers:   return "Layers";
+		case MemoryTag::Text:     return "Text";
+		case MemoryTag::Renderer: return "Renderer";
+		case MemoryTag::Jobs:     return "Jobs";
+		case MemoryTag::Persistent: return "Persistent";
+		default:                  return "Unknown";
+		}
+	}
+
+	MemoryTag AllocationTracker::GetCurrentTag()
+	{
+		return t_CurrentTag;
+	}
+
+	void AllocationTracker::SetCurrentTag(MemoryTag tag)
+	{
+		t_CurrentTag = tag;
+	}
+
+	AllocationStats AllocationTracker::GetStats(MemoryTag tag)
+	{
+		const TagCounters& counters = s_Counters[(size_t)tag];
+
+		AllocationStats stats;
+		stats.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+		stats.LiveCount = counters.LiveCount.load(std::memory_order_relaxed);
+		stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+		stats.TotalAllocations = counters.TotalAllocations.load(std::memory_order_relaxed);
+		stats.TotalBytes = counters.TotalBytes.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	AllocationStats AllocationTracker::GetTotalStats()
+	{
+		AllocationStats total;
+		for (size_t i = 0; i < s_TagCount; i++)
+		{
+			AllocationStats stats = GetStats((MemoryTag)i);
+			total.LiveBytes += stats.LiveBytes;
+			total.LiveCount += stats.LiveCount;
+			total.TotalAllocations += stats.TotalAllocations;
+			total.TotalBytes += stats.TotalBytes;
+		}
+		total.PeakBytes = s_TotalPeakBytes.load(std::memory_order_relaxed);
+		return total;
+	}
+
+	void AllocationTracker::SetBaseline()
+	{
+		for (size_t i = 0; i < s_TagCount; i++)
+		{
+			s_BaselineBytes[i] = s_Counters[i].LiveBytes.load(std::memory_order_relaxed);
+			s_BaselineCount[i] = s_Counters[i].LiveCount.load(std::memory_order_relaxed);
+		}
+	}
+
+	std::string AllocationTracker::BuildReport()
+	{
+		if (!IsEnabled())
+			return "Allocation tracking is disabled, build with --track-allocations\n";
+
+		auto kb = [](int64_t bytes) { return bytes / 1024.0; };
+
+		std::string report = "Allocation report\n";
+		report += std::format("  {0:<10} {1:>12} {2:>10} {3:>12} {4:>12} {5:>14}\n", "Tag", "Live KB", "Live", "Peak KB", "Leaked KB", "Allocations");
+
+		int64_t leakedBytes = 0, leakedCount = 0;
+		for (size_t i = 0; i < s_TagCount; i++)
+		{
+			AllocationStats stats = GetStats((MemoryTag)i);
+			if (stats.TotalAllocations == 0)
+				continue;
+
+			int64_t leaked = 0;
+			if ((MemoryTag)i != MemoryTag::Persistent)
+			{
+				leaked = std::max<int64_t>(stats.LiveBytes - s_BaselineBytes[i], 0);
+				leakedBytes += leaked;
+				leakedCount += std::max<int64_t>(stats.LiveCount - s_BaselineCount[i], 0);
+			}
+
+			report += std::format("  {0:<10} {1:>12.1f} {2:>10} {3:>12.1f} {4:>12.1f} {5:>14}\n", MemoryTagToString((MemoryTag)i),
+				kb(stats.LiveBytes), stats.LiveCount, kb(stats.PeakBytes), kb(leaked), stats.TotalAllocations);
+		}
+
+		AllocationStats total = GetTotalStats();
+		report += std::format("  Peak {0:.1f} KB, live {1:.1f} KB in {2} allocations\n", kb(total.PeakBytes), kb(total.LiveBytes), total.LiveCount);
+		if (leakedCount > 0)
+			report += std::format("  Leaked since baseline: {0} allocations, {1:.1f} KB\n", leakedCount, kb(leakedBytes));
+		else
+			report += "  No leaks since baseline\n";
+		return report;
+	}
+
+	void AllocationTracker::ReportLeaks()
+	{
+		if (!IsEnabled())
+			return;
+
+		std::string report = BuildReport();
+		std::fputs(report.c_str(), stderr);
+	}
+
+#if PS_TRACK_ALLOCATIONS
+
+	static void UpdatePeak(std::atomic<int64_t>& peak, int64_t value)
+	{
+		int64_t current = peak.load(std::memory_order_relaxed);
+		while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	static void RecordAllocation(MemoryTag tag, size_t size)
+	{
+		TagCounters& counters = s_Counters[(size_t)tag];
+		int64_t live = counters.LiveBytes.fetch_add((int64_t)size, std::memory_order_relaxed) + (int64_t)size;
+		counters.LiveCount.fetch_add(1, std::memory_order_relaxed);
+		counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.TotalBytes.fetch_add(size, std::memory_order_relaxed);
+		UpdatePeak(counters.PeakBytes, live);
+
+		int64_t total = s_TotalLiveBytes.fetch_add((int64_t)size, std::memory_order_relaxed) + (int64_t)size;
+		UpdatePeak(s_TotalPeakBytes, total);
+	}
+
+	static void RecordFree(MemoryTag tag, size_t size)
+	{
+		TagCounters& counters = s_Counters[(size_t)tag];
+		counters.LiveBytes.fetch_sub((int64_t)size, std::memory_order_relaxed);
+		counters.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+		s_TotalLiveBytes.fetch_sub((int64_t)size, std::memory_order_relaxed);
+	}
+
+	// Sits right in front of every tracked block, Offset leads back to what malloc returned
+	struct alignas(16) AllocationHeader
+	{
+		uint64_t Size;
+		uint32_t Offset;
+		MemoryTag Tag;
+	};
+
+	static_assert(sizeof(AllocationHeader) == 16);
+
+	static void* TrackedAllocate(size_t size, size_t alignment, bool nothrow)
+	{
+		alignment = std::max(alignment, alignof(AllocationHeader));
+
+		void* raw = std::malloc(size + sizeof(AllocationHeader) + alignment - alignof(AllocationHeader));
+		if (!raw)
+		{
+			if (nothrow)
+				return nullptr;
+			throw std::bad_alloc();
+		}
+
+		uintptr_t user = ((uintptr_t)raw + sizeof(AllocationHeader) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+		header->Size = size;
+		header->Offset = (uint32_t)(user - (uintptr_t)raw);
+		header->Tag = t_CurrentTag;
+
+		RecordAllocation(header->Tag, size);
+		return reinterpret_cast<void*>(user);
+	}
+
+	static void TrackedFree(void* pointer)
+	{
+		if (!pointer)
+			return;
+
+		AllocationHeader* header = static_cast<AllocationHeader*>(pointer) - 1;
+		RecordFree(header->Tag, header->Size);
+		std::free(static_cast<char*>(pointer) - header->Offset);
+	}
+
+#endif
+
+}
+
+#if PS_TRACK_ALLOCATIONS
+
+// Replacement global allocation functions. They live next to the tracker API so the linker pulls
+// them out of the Core static library as soon as App calls into the tracker.
+
+void* operator new(size_t size) { return PulseStudio::TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, false); }
+void* operator new[](size_t size) { return PulseStudio::TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, false); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return PulseStudio::TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, true); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return PulseStudio::TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, true); }
+void* operator new(size_t size, std::align_val_t alignment) { return PulseStudio::TrackedAllocate(size, (size_t)alignment, false); }
+void* operator new[](size_t size, std::align_val_t alignment) { return PulseStudio::TrackedAllocate(size, (size_t)alignment, false); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return PulseStudio::TrackedAllocate(size, (size_t)alignment, true); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return PulseStudio::TrackedAllocate(size, (size_t)alignment, true); }
+
+void operator delete(void* pointer) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { PulseStudio::TrackedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { PulseStudio::TrackedFree(pointer); }
+
+#endif
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Global new/delete are routed through the tracker only when this is set, pass --track-allocations
+// to premake. Kept out of pspch.h dependencies so the logger can include it.
+#ifndef PS_TRACK_ALLOCATIONS
+	#define PS_TRACK_ALLOCATIONS 0
+#endif
+
+namespace PulseStudio {
+
+	// Subsystem an allocation is charged to, taken from the innermost MemoryTagScope on the thread
+	enum class MemoryTag : uint8_t
+	{
+		Untagged = 0,
+		Logger,
+		Events,
+		Layers,
+		Text,
+		Renderer,
+		Jobs,
+		// Process-lifetime caches (profiler rings, pools) that are only freed at exit, never leaks
+		Persistent,
+		Count
+	};
+
+	const char* MemoryTagToString(MemoryTag tag);
+
+	struct AllocationStats
+	{
+		int64_t LiveBytes = 0;
+		int64_t LiveCount = 0;
+		int64_t PeakBytes = 0;
+		uint64_t TotalAllocations = 0;
+		uint64_t TotalBytes = 0;
+	};
+
+	/*
+	* Heap accounting for long-running sessions. With PS_TRACK_ALLOCATIONS every global new/delete
+	* carries a 16-byte header with its size and tag, and per-tag counters are updated with relaxed
+	* atomics; there is no lock and no per-allocation bookkeeping beyond that, so it stays cheap
+	* enough to leave on for a whole session. Without it the API compiles to empty counters.
+	* SetBaseline() marks the start of the interesting lifetime (main), ReportLeaks() prints what is
+	* still live relative to it plus the peaks per subsystem.
+	*/
+	class AllocationTracker
+	{
+	public:
+		static constexpr bool IsEnabled() { return PS_TRACK_ALLOCATIONS != 0; }
+
+		static MemoryTag GetCurrentTag();
+		static void SetCurrentTag(MemoryTag tag);
+
+		static AllocationStats GetStats(MemoryTag tag);
+		static AllocationStats GetTotalStats();
+
+		// Allocations live at this point are not reported as leaks
+		static void SetBaseline();
+
+		// Live and peak usage per tag, growth since the baseline is flagged as leaked
+		static std::string BuildReport();
+		// Write BuildReport() to stderr, for the very end of main when the logger is gone
+		static void ReportLeaks();
+	};
+
+	// Charges allocations on this thread to a tag until the scope ends
+	class MemoryTagScope
+	{
+	public:
+		MemoryTagScope(MemoryTag tag)
+			: m_Previous(AllocationTracker::GetCurrentTag())
+		{
+			AllocationTracker::SetCurrentTag(tag);
+		}
+
+		~MemoryTagScope()
+		{
+			AllocationTracker::SetCurrentTag(m_Previous);
+		}
+
+		MemoryTagScope(const MemoryTagScope&) = delete;
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+	private:
+		MemoryTag m_Previous;
+	};
+
+}
+
+#define PS_MEMORY_TAG_CONCAT_INNER(a, b) a##b
+#define PS_MEMORY_TAG_CONCAT(a, b) PS_MEMORY_TAG_CONCAT_INNER(a, b)
+
+#if PS_TRACK_ALLOCATIONS
+	#define PS_MEMORY_TAG(tag) ::PulseStudio::MemoryTagScope PS_MEMORY_TAG_CONCAT(memoryTagScope, __LINE__)(::PulseStudio::MemoryTag::tag)
+#else
+	#define PS_MEMORY_TAG(tag) ((void)0)
+#endif
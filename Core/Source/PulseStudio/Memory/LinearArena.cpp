@@ -0,0 +1,53 @@
+#include "pspch.h"
+#include "LinearArena.h"
+
+#include "Memory.h"
+
+namespace PulseStudio {
+
+	LinearArena::LinearArena(size_t blockSize)
+		: m_BlockSize(blockSize)
+	{
+	}
+
+	void* LinearArena::Allocate(size_t size, size_t alignment)
+	{
+		for (; m_CurrentBlock < m_Blocks.size(); m_CurrentBlock++)
+		{
+			Block& block = m_Blocks[m_CurrentBlock];
+			uintptr_t base = (uintptr_t)block.Data.get();
+			size_t offset = ((base + block.Used + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+			if (offset + size <= block.Size)
+			{
+				m_Used += offset + size - block.Used;
+				m_AllocationCount++;
+				block.Used = offset + size;
+				Memory::RecordAllocation(size);
+				return block.Data.get() + offset;
+			}
+		}
+
+		// Out of blocks, oversized requests get a block of their own
+		Block block;
+		block.Size = std::max(m_BlockSize, size + alignment);
+		block.Data = std::make_unique<std::byte[]>(block.Size);
+		m_Capacity += block.Size;
+		m_GrowCount++;
+		Memory::RecordHeapAllocation(block.Size);
+		m_Blocks.push_back(std::move(block));
+		m_CurrentBlock = m_Blocks.size() - 1;
+		return Allocate(size, alignment);
+	}
+
+	void LinearArena::Reset()
+	{
+		for (Block& block : m_Blocks)
+			block.Used = 0;
+		m_CurrentBlock = 0;
+
+		m_Used = 0;
+		m_AllocationCount = 0;
+		m_GrowCount = 0;
+	}
+
+}
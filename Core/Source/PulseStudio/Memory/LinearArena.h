@@ -0,0 +1,69 @@
+#pragma once
+
+#include "pspch.h"
+
+namespace PulseStudio {
+
+	/*
+	* Bump allocator over a list of blocks. Allocation is an align and an add, individual frees do
+	* not exist; Reset() rewinds every block and keeps the memory, so an arena that is reset at a
+	* fixed point (every frame, every render queue) stops allocating once its blocks have grown to
+	* the largest working set seen. Not thread-safe, objects are not destroyed on Reset.
+	*/
+	class LinearArena
+	{
+	public:
+		static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+		LinearArena(size_t blockSize = DefaultBlockSize);
+		~LinearArena() = default;
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		// Construct an object in the arena, it is never destroyed so it must not own anything
+		template<typename T, typename... Args>
+		T* New(Args&&... args)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		T* NewArray(size_t count)
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+			T* items = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+			std::uninitialized_value_construct_n(items, count);
+			return items;
+		}
+
+		void Reset();
+
+		// Since the last Reset
+		inline size_t GetUsed() const { return m_Used; }
+		inline uint32_t GetAllocationCount() const { return m_AllocationCount; }
+		// Blocks that had to be allocated from the heap since the last Reset
+		inline uint32_t GetGrowCount() const { return m_GrowCount; }
+		inline size_t GetCapacity() const { return m_Capacity; }
+	private:
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> Data;
+			size_t Size = 0;
+			size_t Used = 0;
+		};
+
+		std::vector<Block> m_Blocks;
+		size_t m_CurrentBlock = 0;
+		size_t m_BlockSize;
+
+		size_t m_Used = 0;
+		size_t m_Capacity = 0;
+		uint32_t m_AllocationCount = 0;
+		uint32_t m_GrowCount = 0;
+	};
+
+}
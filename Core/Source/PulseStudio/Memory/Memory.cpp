@@ -0,0 +1,118 @@
+#include "pspch.h"
+#include "Memory.h"
+
+#include "MemoryResource.h"
+#include "AllocationTracker.h"
+#include "PulseStudio/Profiler.h"
+
+namespace PulseStudio {
+
+	std::atomic<uint64_t> Memory::s_Allocations = 0;
+	std::atomic<uint64_t> Memory::s_Bytes = 0;
+	std::atomic<uint64_t> Memory::s_HeapAllocations = 0;
+	std::atomic<uint64_t> Memory::s_HeapBytes = 0;
+
+	MemoryFrameStats Memory::s_LastFrameStats;
+	uint32_t Memory::s_SummaryInterval = 0;
+
+	static constexpr size_t s_FrameArenaBlockSize = 256 * 1024;
+
+	struct FrameArenas
+	{
+		std::array<LinearArena, 2> Arenas = { LinearArena(s_FrameArenaBlockSize), LinearArena(s_FrameArenaBlockSize) };
+		std::array<ArenaMemoryResource, 2> Resources = { ArenaMemoryResource(Arenas[0]), ArenaMemoryResource(Arenas[1]) };
+		uint32_t Current = 0;
+	};
+
+	static FrameArenas& GetFrameArenas()
+	{
+		static FrameArenas s_FrameArenas;
+		return s_FrameArenas;
+	}
+
+	// Rolling summary
+	static MemoryFrameStats s_SummaryTotal;
+	static uint64_t s_SummaryMaxBytes = 0;
+	static uint32_t s_SummaryFrames = 0;
+
+	// Live heap bytes per tag as profiler counter tracks
+	static void RecordHeapCounters()
+	{
+		static std::array<const char*, (size_t)MemoryTag::Count> s_CounterNames = []()
+		{
+			std::array<const char*, (size_t)MemoryTag::Count> names;
+			for (size_t i = 0; i < names.size(); i++)
+				names[i] = Profiler::InternName(std::string("Heap ") + MemoryTagToString((MemoryTag)i) + " bytes");
+			return names;
+		}();
+
+		Profiler::RecordCounter("Heap live bytes", AllocationTracker::GetTotalStats().LiveBytes);
+		for (size_t i = 0; i < s_CounterNames.size(); i++)
+		{
+			AllocationStats stats = AllocationTracker::GetStats((MemoryTag)i);
+			if (stats.TotalAllocations > 0)
+				Profiler::RecordCounter(s_CounterNames[i], stats.LiveBytes);
+		}
+	}
+
+	void Memory::BeginFrame()
+	{
+		FrameArenas& frame = GetFrameArenas();
+		LinearArena& finished = frame.Arenas[frame.Current];
+
+		MemoryFrameStats stats;
+		stats.Allocations = s_Allocations.exchange(0, std::memory_order_relaxed);
+		stats.Bytes = s_Bytes.exchange(0, std::memory_order_relaxed);
+		stats.HeapAllocations = s_HeapAllocations.exchange(0, std::memory_order_relaxed);
+		stats.HeapBytes = s_HeapBytes.exchange(0, std::memory_order_relaxed);
+		stats.FrameArenaUsed = finished.GetUsed();
+		stats.FrameArenaCapacity = finished.GetCapacity();
+		s_LastFrameStats = stats;
+
+		// The arena used two frames ago is free again
+		frame.Current ^= 1;
+		frame.Arenas[frame.Current].Reset();
+
+		if (Profiler::IsEnabled())
+		{
+			Profiler::RecordCounter("Frame allocations", (int64_t)stats.Allocations);
+			Profiler::RecordCounter("Frame heap allocations", (int64_t)stats.HeapAllocations);
+			if (AllocationTracker::IsEnabled())
+				RecordHeapCounters();
+		}
+
+		if (s_SummaryInterval == 0)
+			return;
+
+		s_SummaryTotal.Allocations += stats.Allocations;
+		s_SummaryTotal.Bytes += stats.Bytes;
+		s_SummaryTotal.HeapAllocations += stats.HeapAllocations;
+		s_SummaryTotal.HeapBytes += stats.HeapBytes;
+		s_SummaryMaxBytes = std::max(s_SummaryMaxBytes, stats.Bytes);
+
+		if (++s_SummaryFrames < s_SummaryInterval)
+			return;
+
+		PS_CORE_INFO("Memory: {0} frames, {1:.1f} allocations / {2:.1f} KB per frame (max {3:.1f} KB), {4} heap allocations ({5:.1f} KB), frame arena {6:.1f} / {7:.1f} KB",
+			s_SummaryFrames, (double)s_SummaryTotal.Allocations / s_SummaryFrames, s_SummaryTotal.Bytes / 1024.0 / s_SummaryFrames,
+			s_SummaryMaxBytes / 1024.0, s_SummaryTotal.HeapAllocations, s_SummaryTotal.HeapBytes / 1024.0,
+			stats.FrameArenaUsed / 1024.0, stats.FrameArenaCapacity / 1024.0);
+
+		s_SummaryTotal = {};
+		s_SummaryMaxBytes = 0;
+		s_SummaryFrames = 0;
+	}
+
+	LinearArena& Memory::GetFrameArena()
+	{
+		FrameArenas& frame = GetFrameArenas();
+		return frame.Arenas[frame.Current];
+	}
+
+	std::pmr::memory_resource* Memory::GetFrameResource()
+	{
+		FrameArenas& frame = GetFrameArenas();
+		return &frame.Resources[frame.Current];
+	}
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "LinearArena.h"
+
+#include <atomic>
+#include <memory_resource>
+
+namespace PulseStudio {
+
+	struct MemoryFrameStats
+	{
+		// Requests served by arenas and pools
+		uint64_t Allocations = 0;
+		uint64_t Bytes = 0;
+		// Blocks and chunks arenas and pools had to take from the general heap, zero in steady state
+		uint64_t HeapAllocations = 0;
+		uint64_t HeapBytes = 0;
+
+		size_t FrameArenaUsed = 0;
+		size_t FrameArenaCapacity = 0;
+	};
+
+	/*
+	* Frame-scoped memory. The frame arena is a pair of LinearArenas used on alternate frames and
+	* reset by BeginFrame(), so frame memory stays valid until the end of the following frame; that
+	* covers the render thread executing a frame while the next one is being built. Frame memory
+	* is for the main thread only, scratch containers opt in through GetFrameResource().
+	* Arenas and pools report into per-frame counters, the last complete frame is available from
+	* GetLastFrameStats() and summarized in the log every SetSummaryInterval() frames.
+	*/
+	class Memory
+	{
+	public:
+		// Main thread, once per submitted frame. Idle iterations that submit nothing skip it, so the
+		// memory of the last submitted frame stays valid for as long as that frame can be replayed.
+		static void BeginFrame();
+
+		static LinearArena& GetFrameArena();
+		static std::pmr::memory_resource* GetFrameResource();
+
+		static const MemoryFrameStats& GetLastFrameStats() { return s_LastFrameStats; }
+
+		// Log a summary every this many frames, 0 turns the summary off
+		static void SetSummaryInterval(uint32_t frames) { s_SummaryInterval = frames; }
+
+		// Counters fed by arenas and pools, callable from any thread
+		static inline void RecordAllocation(size_t bytes)
+		{
+			s_Allocations.fetch_add(1, std::memory_order_relaxed);
+			s_Bytes.fetch_add(bytes, std::memory_order_relaxed);
+		}
+
+		static inline void RecordHeapAllocation(size_t bytes)
+		{
+			s_HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+			s_HeapBytes.fetch_add(bytes, std::memory_order_relaxed);
+		}
+	private:
+		static std::atomic<uint64_t> s_Allocations;
+		static std::atomic<uint64_t> s_Bytes;
+		static std::atomic<uint64_t> s_HeapAllocations;
+		static std::atomic<uint64_t> s_HeapBytes;
+
+		static MemoryFrameStats s_LastFrameStats;
+		static uint32_t s_SummaryInterval;
+	};
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "LinearArena.h"
+
+#include <memory_resource>
+
+namespace PulseStudio {
+
+	// std::pmr adapter over a LinearArena, deallocation is a no-op and memory comes back on Reset
+	class ArenaMemoryResource : public std::pmr::memory_resource
+	{
+	public:
+		ArenaMemoryResource(LinearArena& arena)
+			: m_Arena(arena)
+		{
+		}
+
+		inline LinearArena& GetArena() const { return m_Arena; }
+	private:
+		void* do_allocate(size_t bytes, size_t alignment) override
+		{
+			return m_Arena.Allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void*, size_t, size_t) override
+		{
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			return this == &other;
+		}
+
+		LinearArena& m_Arena;
+	};
+
+	// Scratch containers that live until the end of the next frame, e.g.
+	//   FrameVector<Rect> rects(Memory::GetFrameResource());
+	template<typename T>
+	using FrameVector = std::pmr::vector<T>;
+	using FrameString = std::pmr::string;
+
+}
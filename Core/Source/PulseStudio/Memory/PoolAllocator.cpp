@@ -0,0 +1,74 @@
+#include "pspch.h"
+#include "PoolAllocator.h"
+
+#include "Memory.h"
+
+namespace PulseStudio {
+
+	PoolAllocator::PoolAllocator(size_t slotSize, size_t slotAlignment, size_t slotsPerChunk)
+		: m_SlotsPerChunk(std::max<size_t>(slotsPerChunk, 1))
+	{
+		// Every slot has to be able to hold the free list link and stay aligned in the chunk
+		size_t alignment = std::max(slotAlignment, alignof(FreeSlot));
+		m_SlotSize = (std::max(slotSize, sizeof(FreeSlot)) + alignment - 1) & ~(alignment - 1);
+
+		PS_CORE_ASSERT(alignment <= alignof(std::max_align_t), "Over-aligned pool slots are not supported");
+	}
+
+	void* PoolAllocator::Allocate()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!m_FreeList)
+			AddChunk();
+
+		FreeSlot* slot = m_FreeList;
+		m_FreeList = slot->Next;
+		m_LiveCount++;
+
+		Memory::RecordAllocation(m_SlotSize);
+		return slot;
+	}
+
+	void PoolAllocator::Free(void* slot)
+	{
+		if (!slot)
+			return;
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		FreeSlot* freeSlot = static_cast<FreeSlot*>(slot);
+		freeSlot->Next = m_FreeList;
+		m_FreeList = freeSlot;
+		m_LiveCount--;
+	}
+
+	size_t PoolAllocator::GetLiveCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_LiveCount;
+	}
+
+	size_t PoolAllocator::GetCapacity() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Chunks.size() * m_SlotsPerChunk;
+	}
+
+	void PoolAllocator::AddChunk()
+	{
+		// Chunks stay until the pool goes away, usually at exit
+		PS_MEMORY_TAG(Persistent);
+		size_t chunkSize = m_SlotSize * m_SlotsPerChunk;
+		m_Chunks.push_back(std::make_unique<std::byte[]>(chunkSize));
+		Memory::RecordHeapAllocation(chunkSize);
+
+		// Thread the new slots onto the free list in address order
+		std::byte* base = m_Chunks.back().get();
+		for (size_t i = m_SlotsPerChunk; i > 0; i--)
+		{
+			FreeSlot* slot = reinterpret_cast<FreeSlot*>(base + (i - 1) * m_SlotSize);
+			slot->Next = m_FreeList;
+			m_FreeList = slot;
+		}
+	}
+
+}
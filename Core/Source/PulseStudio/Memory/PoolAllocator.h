@@ -0,0 +1,75 @@
+#pragma once
+
+#include "pspch.h"
+
+namespace PulseStudio {
+
+	/*
+	* Fixed-size slot allocator for hot small objects. Slots are carved out of chunks and recycled
+	* through an intrusive free list, chunks are only returned when the pool is destroyed.
+	* Allocate/Free are thread-safe (a slot may be freed on a different thread than it was allocated
+	* on, jobs are), the lock is held for a handful of instructions.
+	*/
+	class PoolAllocator
+	{
+	public:
+		PoolAllocator(size_t slotSize, size_t slotAlignment, size_t slotsPerChunk = 256);
+		~PoolAllocator() = default;
+
+		PoolAllocator(const PoolAllocator&) = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+		void* Allocate();
+		void Free(void* slot);
+
+		inline size_t GetSlotSize() const { return m_SlotSize; }
+		size_t GetLiveCount() const;
+		size_t GetCapacity() const;
+	private:
+		struct FreeSlot
+		{
+			FreeSlot* Next;
+		};
+
+		void AddChunk();
+
+		size_t m_SlotSize;
+		size_t m_SlotsPerChunk;
+
+		mutable std::mutex m_Mutex;
+		FreeSlot* m_FreeList = nullptr;
+		std::vector<std::unique_ptr<std::byte[]>> m_Chunks;
+		size_t m_LiveCount = 0;
+	};
+
+	// Typed front end of PoolAllocator
+	template<typename T>
+	class ObjectPool
+	{
+	public:
+		ObjectPool(size_t slotsPerChunk = 256)
+			: m_Allocator(sizeof(T), alignof(T), slotsPerChunk)
+		{
+		}
+
+		template<typename... Args>
+		T* New(Args&&... args)
+		{
+			return new (m_Allocator.Allocate()) T(std::forward<Args>(args)...);
+		}
+
+		void Delete(T* object)
+		{
+			if (!object)
+				return;
+
+			object->~T();
+			m_Allocator.Free(object);
+		}
+
+		inline size_t GetLiveCount() const { return m_Allocator.GetLiveCount(); }
+	private:
+		PoolAllocator m_Allocator;
+	};
+
+}
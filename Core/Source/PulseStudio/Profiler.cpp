@@ -0,0 +1,286 @@
+#include "pspch.h"
+#include "Profiler.h"
+
+namespace PulseStudio {
+
+	// Zones per thread, a power of two
+	static constexpr size_t s_ZoneCapacity = 64 * 1024;
+	// Oldest zones a reader skips because a writer may be overwriting them
+	static constexpr size_t s_ReadGuard = 1024;
+
+	struct ProfileThreadBuffer
+	{
+		std::unique_ptr<ProfileZone[]> Zones = std::make_unique<ProfileZone[]>(s_ZoneCapacity);
+		std::atomic<uint64_t> WriteIndex = 0;
+		uint32_t ThreadId = 0;
+		std::string Name;
+	};
+
+	struct ProfileFrame
+	{
+		int64_t Start = 0;
+		int64_t End = 0;
+	};
+
+	struct ProfileCounter
+	{
+		const char* Name;
+		int64_t Time;
+		int64_t Value;
+	};
+
+	struct ProfileSummaryEntry
+	{
+		const char* Name;
+		int64_t Total;
+	};
+
+	std::atomic<bool> Profiler::s_Enabled = PS_PROFILE != 0;
+	uint32_t Profiler::s_SummaryInterval = 0;
+
+	// Buffers are shared so zones of threads that already exited can still be exported
+	static std::mutex s_ThreadsMutex;
+	static std::vector<std::shared_ptr<ProfileThreadBuffer>> s_Threads;
+	static thread_local ProfileThreadBuffer* t_Buffer = nullptr;
+
+	static std::mutex s_NamesMutex;
+	static std::unordered_set<std::string> s_Names;
+
+	// Frame markers, main thread only
+	static std::array<ProfileFrame, Profiler::MaxFrames> s_Frames;
+	static uint64_t s_FrameCount = 0;
+	static int64_t s_FrameStart = 0;
+	static uint64_t s_FrameZoneStart = 0;
+
+	// Counter samples, main thread only
+	static constexpr size_t s_CounterCapacity = 16 * 1024;
+	static std::array<ProfileCounter, s_CounterCapacity> s_Counters;
+	static uint64_t s_CounterCount = 0;
+
+	// Rolling summary
+	static std::vector<ProfileSummaryEntry> s_SummaryZones;
+	static std::vector<ProfileSummaryEntry> s_SummaryCounters;
+	static uint32_t s_SummaryFrames = 0;
+	static int64_t s_SummaryTotal = 0;
+	static int64_t s_SummaryMax = 0;
+
+	static ProfileThreadBuffer& GetThreadBuffer()
+	{
+		if (!t_Buffer)
+		{
+			PS_MEMORY_TAG(Persistent);
+			auto buffer = std::make_shared<ProfileThreadBuffer>();
+			std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+			buffer->ThreadId = (uint32_t)s_Threads.size() + 1;
+			buffer->Name = "Thread " + std::to_string(buffer->ThreadId);
+			s_Threads.push_back(buffer);
+			t_Buffer = buffer.get();
+		}
+		return *t_Buffer;
+	}
+
+	void Profiler::SetThreadName(const std::string& name)
+	{
+		PS_MEMORY_TAG(Persistent);
+		ProfileThreadBuffer& buffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+		buffer.Name = name;
+	}
+
+	const char* Profiler::InternName(const std::string& name)
+	{
+		PS_MEMORY_TAG(Persistent);
+		std::lock_guard<std::mutex> lock(s_NamesMutex);
+		return s_Names.insert(name).first->c_str();
+	}
+
+	void Profiler::RecordZone(const char* name, int64_t start, int64_t end)
+	{
+		if (!name)
+			return;
+
+		ProfileThreadBuffer& buffer = GetThreadBuffer();
+		uint64_t index = buffer.WriteIndex.load(std::memory_order_relaxed);
+		buffer.Zones[index & (s_ZoneCapacity - 1)] = { name, start, end };
+		buffer.WriteIndex.store(index + 1, std::memory_order_release);
+	}
+
+	void Profiler::RecordCounter(const char* name, int64_t value)
+	{
+		if (!name || !IsEnabled())
+			return;
+
+		s_Counters[s_CounterCount % s_CounterCapacity] = { name, Now(), value };
+		s_CounterCount++;
+
+		if (s_SummaryInterval == 0)
+			return;
+
+		// The summary shows the latest value
+		auto it = std::find_if(s_SummaryCounters.begin(), s_SummaryCounters.end(), [name](const ProfileSummaryEntry& entry) { return entry.Name == name; });
+		if (it == s_SummaryCounters.end())
+			s_SummaryCounters.push_back({ name, value });
+		else
+			it->Total = value;
+	}
+
+	void Profiler::BeginFrame()
+	{
+		s_FrameStart = Now();
+		s_FrameZoneStart = GetThreadBuffer().WriteIndex.load(std::memory_order_relaxed);
+	}
+
+	void Profiler::EndFrame()
+	{
+		if (!IsEnabled() || s_FrameStart == 0)
+			return;
+
+		int64_t end = Now();
+		s_Frames[s_FrameCount % MaxFrames] = { s_FrameStart, end };
+		s_FrameCount++;
+		RecordZone("Frame", s_FrameStart, end);
+
+		if (s_SummaryInterval > 0)
+			UpdateSummary(s_FrameStart, end);
+		s_FrameStart = 0;
+	}
+
+	void Profiler::UpdateSummary(int64_t frameStart, int64_t frameEnd)
+	{
+		// Zones the main thread recorded during this frame, nested zones count in full
+		ProfileThreadBuffer& buffer = GetThreadBuffer();
+		uint64_t end = buffer.WriteIndex.load(std::memory_order_relaxed);
+		uint64_t begin = std::max(s_FrameZoneStart, end > s_ZoneCapacity ? end - s_ZoneCapacity : 0);
+		for (uint64_t i = begin; i < end; i++)
+		{
+			const ProfileZone& zone = buffer.Zones[i & (s_ZoneCapacity - 1)];
+			if (zone.Start < frameStart)
+				continue;
+
+			auto it = std::find_if(s_SummaryZones.begin(), s_SummaryZones.end(), [&zone](const ProfileSummaryEntry& entry) { return entry.Name == zone.Name; });
+			if (it == s_SummaryZones.end())
+				s_SummaryZones.push_back({ zone.Name, zone.End - zone.Start });
+			else
+				it->Total += zone.End - zone.Start;
+		}
+
+		int64_t frameTime = frameEnd - frameStart;
+		s_SummaryTotal += frameTime;
+		s_SummaryMax = std::max(s_SummaryMax, frameTime);
+		if (++s_SummaryFrames < s_SummaryInterval)
+			return;
+
+		std::sort(s_SummaryZones.begin(), s_SummaryZones.end(), [](const ProfileSummaryEntry& a, const ProfileSummaryEntry& b) { return a.Total > b.Total; });
+
+		auto ms = [](int64_t ns) { return ns / 1000000.0; };
+		std::string zones;
+		for (size_t i = 0; i < s_SummaryZones.size() && i < 6; i++)
+		{
+			if (s_SummaryZones[i].Name == std::string_view("Frame"))
+				continue;
+			zones += std::format(" | {0} {1:.3f} ms", s_SummaryZones[i].Name, ms(s_SummaryZones[i].Total) / s_SummaryFrames);
+		}
+		for (const ProfileSummaryEntry& counter : s_SummaryCounters)
+			zones += std::format(" | {0} {1}", counter.Name, counter.Total);
+		PS_CORE_INFO("Profiler: {0} frames, avg {1:.2f} ms, max {2:.2f} ms{3}", s_SummaryFrames, ms(s_SummaryTotal) / s_SummaryFrames, ms(s_SummaryMax), zones);
+
+		s_SummaryZones.clear();
+		s_SummaryFrames = 0;
+		s_SummaryTotal = 0;
+		s_SummaryMax = 0;
+	}
+
+	static void WriteJsonString(std::string& out, std::string_view value)
+	{
+		out += '"';
+		for (char c : value)
+		{
+			if (c == '"' || c == '\\')
+				out += '\\';
+			if ((unsigned char)c < 0x20)
+				continue;
+			out += c;
+		}
+		out += '"';
+	}
+
+	bool Profiler::WriteChromeTrace(const std::string& path, uint32_t frameCount)
+	{
+		uint64_t frames = std::min<uint64_t>({ frameCount, s_FrameCount, MaxFrames });
+		if (frames == 0)
+		{
+			PS_CORE_WARN("No profiled frames to write to {0}", path);
+			return false;
+		}
+
+		int64_t windowStart = s_Frames[(s_FrameCount - frames) % MaxFrames].Start;
+		int64_t windowEnd = s_Frames[(s_FrameCount - 1) % MaxFrames].End;
+
+		std::vector<std::pair<std::string, uint32_t>> threads;
+		std::vector<std::vector<ProfileZone>> zones;
+		{
+			std::lock_guard<std::mutex> lock(s_ThreadsMutex);
+			for (const auto& buffer : s_Threads)
+			{
+				uint64_t end = buffer->WriteIndex.load(std::memory_order_acquire);
+				uint64_t begin = end > s_ZoneCapacity - s_ReadGuard ? end - (s_ZoneCapacity - s_ReadGuard) : 0;
+
+				std::vector<ProfileZone> threadZones;
+				for (uint64_t i = begin; i < end; i++)
+				{
+					const ProfileZone& zone = buffer->Zones[i & (s_ZoneCapacity - 1)];
+					if (zone.End >= windowStart && zone.Start <= windowEnd)
+						threadZones.push_back(zone);
+				}
+
+				threads.emplace_back(buffer->Name, buffer->ThreadId);
+				zones.push_back(std::move(threadZones));
+			}
+		}
+
+		std::string json;
+		json.reserve(1024 * 1024);
+		json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		bool first = true;
+		for (size_t t = 0; t < threads.size(); t++)
+		{
+			json += first ? "" : ",";
+			first = false;
+			json += std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":", threads[t].second);
+			WriteJsonString(json, threads[t].first);
+			json += "}}";
+
+			for (const ProfileZone& zone : zones[t])
+			{
+				json += ",{\"name\":";
+				WriteJsonString(json, zone.Name);
+				json += std::format(",\"ph\":\"X\",\"pid\":1,\"tid\":{0},\"ts\":{1:.3f},\"dur\":{2:.3f}}}",
+					threads[t].second, (zone.Start - windowStart) / 1000.0, (zone.End - zone.Start) / 1000.0);
+			}
+		}
+		// Counter tracks, sampled on the main thread
+		uint64_t counterBegin = s_CounterCount > s_CounterCapacity ? s_CounterCount - s_CounterCapacity : 0;
+		for (uint64_t i = counterBegin; i < s_CounterCount; i++)
+		{
+			const ProfileCounter& counter = s_Counters[i % s_CounterCapacity];
+			if (counter.Time < windowStart || counter.Time > windowEnd)
+				continue;
+
+			json += ",{\"name\":";
+			WriteJsonString(json, counter.Name);
+			json += std::format(",\"ph\":\"C\",\"pid\":1,\"ts\":{0:.3f},\"args\":{{\"value\":{1}}}}}", (counter.Time - windowStart) / 1000.0, counter.Value);
+		}
+		json += "]}\n";
+
+		std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			PS_CORE_ERROR("Failed to open trace file {0}", path);
+			return false;
+		}
+		file.write(json.data(), (std::streamsize)json.size());
+		PS_CORE_INFO("Wrote {0} profiled frames to {1}", frames, path);
+		return true;
+	}
+
+}
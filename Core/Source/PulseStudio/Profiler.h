@@ -0,0 +1,110 @@
+#pragma once
+
+#include "pspch.h"
+
+#include <atomic>
+
+// Profiling zones are compiled out entirely in Dist, define PS_PROFILE to override
+#ifndef PS_PROFILE
+	#ifdef DIST
+		#define PS_PROFILE 0
+	#else
+		#define PS_PROFILE 1
+	#endif
+#endif
+
+namespace PulseStudio {
+
+	// A finished zone, timestamps are steady_clock nanoseconds
+	struct ProfileZone
+	{
+		const char* Name;
+		int64_t Start;
+		int64_t End;
+	};
+
+	/*
+	* Frame profiler. Zones are written into a per-thread ring buffer by their owning thread only (one
+	* relaxed load and one release store per zone, no locks); a lock is only taken the first time a
+	* thread records. Old zones are overwritten, the buffers hold the last few hundred frames.
+	* Readers copy the buffers while threads keep recording and skip the oldest stretch of each ring,
+	* which is the part a writer could be overwriting.
+	* BeginFrame()/EndFrame() mark frames on the main thread, they drive the Chrome trace export
+	* (chrome://tracing, Perfetto) and a rolling per-frame summary written to the log.
+	*/
+	class Profiler
+	{
+	public:
+		static constexpr uint32_t MaxFrames = 300;
+
+		static inline bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+		static void SetEnabled(bool enabled) { s_Enabled.store(enabled, std::memory_order_relaxed); }
+
+		// Name of the calling thread in exported traces
+		static void SetThreadName(const std::string& name);
+
+		// Stable copy of a runtime string (layer names and such), safe to use as a zone name
+		static const char* InternName(const std::string& name);
+
+		static void BeginFrame();
+		static void EndFrame();
+
+		// Log a summary every this many frames, 0 turns the summary off
+		static void SetSummaryInterval(uint32_t frames) { s_SummaryInterval = frames; }
+
+		// Write the last frameCount frames from every thread as Chrome trace JSON
+		static bool WriteChromeTrace(const std::string& path, uint32_t frameCount = MaxFrames);
+
+		static inline int64_t Now()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		static void RecordZone(const char* name, int64_t start, int64_t end);
+
+		// Sample a value (live heap bytes, allocations per frame) for a counter track, main thread only
+		static void RecordCounter(const char* name, int64_t value);
+	private:
+		static void UpdateSummary(int64_t frameStart, int64_t frameEnd);
+
+		static std::atomic<bool> s_Enabled;
+		static uint32_t s_SummaryInterval;
+	};
+
+	// Records its lifetime as a zone, the name must outlive the profiler (literals or InternName)
+	class ProfileScope
+	{
+	public:
+		ProfileScope(const char* name)
+			: m_Name(name), m_Start(Profiler::IsEnabled() ? Profiler::Now() : 0)
+		{
+		}
+
+		~ProfileScope()
+		{
+			if (m_Start != 0)
+				Profiler::RecordZone(m_Name, m_Start, Profiler::Now());
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+	private:
+		const char* m_Name;
+		int64_t m_Start;
+	};
+
+}
+
+#define PS_PROFILE_CONCAT_INNER(a, b) a##b
+#define PS_PROFILE_CONCAT(a, b) PS_PROFILE_CONCAT_INNER(a, b)
+
+#if PS_PROFILE
+	#define PS_PROFILE_SCOPE(name) ::PulseStudio::ProfileScope PS_PROFILE_CONCAT(profileScope, __LINE__)(name)
+	#define PS_PROFILE_FUNCTION() PS_PROFILE_SCOPE(__FUNCTION__)
+	// For names built at runtime, interned only while profiling is enabled
+	#define PS_PROFILE_SCOPE_DYNAMIC(name) PS_PROFILE_SCOPE(::PulseStudio::Profiler::IsEnabled() ? ::PulseStudio::Profiler::InternName(name) : nullptr)
+#else
+	#define PS_PROFILE_SCOPE(name) ((void)0)
+	#define PS_PROFILE_FUNCTION() ((void)0)
+	#define PS_PROFILE_SCOPE_DYNAMIC(name) ((void)0)
+#endif
@@ -0,0 +1,108 @@
+#include "pspch.h"
+#include "Batch2D.h"
+
+namespace PulseStudio {
+
+	Batch2D::Batch2D(size_t initialQuads)
+	{
+		m_Vertices.reserve(initialQuads * 4);
+		m_Commands.reserve(64);
+	}
+
+	void Batch2D::Clear()
+	{
+		m_Vertices.clear();
+		m_Commands.clear();
+	}
+
+	void Batch2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
+	{
+		DrawQuad(position, size, TextureRegion(), color);
+	}
+
+	void Batch2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const TextureRegion& region, const glm::vec4& tint)
+	{
+		const glm::vec2 corners[4] =
+		{
+			position,
+			{ position.x + size.x, position.y },
+			position + size,
+			{ position.x, position.y + size.y }
+		};
+		PushQuad(corners, region.Min, region.Max, PackColor(tint), region.TextureID);
+	}
+
+	void Batch2D::DrawDistanceField(const glm::vec2& position, const glm::vec2& size, const TextureRegion& region, const glm::vec4& color)
+	{
+		const glm::vec2 corners[4] =
+		{
+			position,
+			{ position.x + size.x, position.y },
+			position + size,
+			{ position.x, position.y + size.y }
+		};
+		PushQuad(corners, region.Min, region.Max, PackColor(color), region.TextureID, size * 0.5f, -1.0f);
+	}
+
+	void Batch2D::DrawLine(const glm::vec2& from, const glm::vec2& to, float thickness, const glm::vec4& color)
+	{
+		glm::vec2 direction = to - from;
+		float length = glm::length(direction);
+		if (length <= 0.0f)
+			return;
+
+		// Extrude half the thickness to either side of the segment
+		glm::vec2 normal = glm::vec2(-direction.y, direction.x) * (thickness * 0.5f / length);
+		const glm::vec2 corners[4] = { from + normal, to + normal, to - normal, from - normal };
+		PushQuad(corners, glm::vec2(0.0f), glm::vec2(1.0f), PackColor(color), 0);
+	}
+
+	void Batch2D::DrawRoundedRect(const glm::vec2& position, const glm::vec2& size, float radius, const glm::vec4& color)
+	{
+		glm::vec2 halfSize = size * 0.5f;
+		// A negative size must not put the upper bound below the lower one
+		radius = std::clamp(radius, 0.0f, std::max(0.0f, std::min(halfSize.x, halfSize.y)));
+
+		const glm::vec2 corners[4] =
+		{
+			position,
+			{ position.x + size.x, position.y },
+			position + size,
+			{ position.x, position.y + size.y }
+		};
+		PushQuad(corners, glm::vec2(0.0f), glm::vec2(1.0f), PackColor(color), 0, halfSize, radius);
+	}
+
+	Renderer2DStats Batch2D::GetStats() const
+	{
+		Renderer2DStats stats;
+		stats.DrawCalls = (uint32_t)m_Commands.size();
+		stats.Quads = GetQuadCount();
+		stats.Vertices = (uint32_t)m_Vertices.size();
+		stats.Indices = stats.Quads * 6;
+		return stats;
+	}
+
+	uint32_t Batch2D::PackColor(const glm::vec4& color)
+	{
+		glm::vec4 clamped = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+		return (uint32_t)clamped.r | ((uint32_t)clamped.g << 8) | ((uint32_t)clamped.b << 16) | ((uint32_t)clamped.a << 24);
+	}
+
+	void Batch2D::PushQuad(const glm::vec2 (&corners)[4], const glm::vec2& uvMin, const glm::vec2& uvMax, uint32_t color, uint32_t textureID,
+		const glm::vec2& halfSize, float radius)
+	{
+		uint32_t quad = GetQuadCount();
+		if (m_Commands.empty() || m_Commands.back().TextureID != textureID)
+			m_Commands.push_back({ textureID, quad, 0 });
+		m_Commands.back().QuadCount++;
+
+		const glm::vec2 texCoords[4] = { uvMin, { uvMax.x, uvMin.y }, uvMax, { uvMin.x, uvMax.y } };
+		glm::vec2 center = (corners[0] + corners[2]) * 0.5f;
+		glm::vec3 shape(halfSize, radius);
+
+		for (int i = 0; i < 4; i++)
+			m_Vertices.push_back({ corners[i], texCoords[i], color, corners[i] - center, shape });
+	}
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "pspch.h"
+
+#include <glm/glm.hpp>
+
+namespace PulseStudio {
+
+	// Interleaved vertex layout shared with the Renderer2D shader
+	struct Batch2DVertex
+	{
+		glm::vec2 Position;		// Pixels, origin top left
+		glm::vec2 TexCoord;
+		uint32_t Color;			// RGBA8, R in the low byte
+		glm::vec2 Local;		// Position relative to the shape center, pixels
+		glm::vec3 Shape;		// Half size and corner radius, radius 0 draws a plain quad and a
+								// negative radius reads the texture alpha as a distance field
+	};
+
+	// One draw: a run of consecutive quads sharing a texture
+	struct Batch2DCommand
+	{
+		uint32_t TextureID;		// Renderer2D texture handle, 0 samples the built-in white texture
+		uint32_t FirstQuad;
+		uint32_t QuadCount;
+	};
+
+	// Texture coordinates of an atlas entry
+	struct TextureRegion
+	{
+		uint32_t TextureID = 0;
+		glm::vec2 Min = { 0.0f, 0.0f };
+		glm::vec2 Max = { 1.0f, 1.0f };
+	};
+
+	struct Renderer2DStats
+	{
+		uint32_t DrawCalls = 0;
+		uint32_t Quads = 0;
+		uint32_t Vertices = 0;
+		uint32_t Indices = 0;
+	};
+
+	/*
+	* CPU side of the 2D renderer: turns quads, lines and rounded rects into vertices and a list of
+	* draws, merging consecutive shapes that use the same texture. Everything is expressed as quads
+	* (four vertices, six indices from a shared index pattern), rounded corners are cut out in the
+	* fragment shader from Local/Shape. No GL is involved, so a batch can be built and inspected
+	* without a context; Clear() keeps the capacity, steady-state frames do not allocate.
+	*/
+	class Batch2D
+	{
+	public:
+		Batch2D(size_t initialQuads = 1024);
+
+		void Clear();
+
+		void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+		void DrawQuad(const glm::vec2& position, const glm::vec2& size, const TextureRegion& region, const glm::vec4& tint = glm::vec4(1.0f));
+		// Region alpha is a signed distance field with the outline at 0.5, sharp at any scale
+		void DrawDistanceField(const glm::vec2& position, const glm::vec2& size, const TextureRegion& region, const glm::vec4& color);
+		void DrawLine(const glm::vec2& from, const glm::vec2& to, float thickness, const glm::vec4& color);
+		void DrawRoundedRect(const glm::vec2& position, const glm::vec2& size, float radius, const glm::vec4& color);
+
+		inline const std::vector<Batch2DVertex>& GetVertices() const { return m_Vertices; }
+		inline const std::vector<Batch2DCommand>& GetCommands() const { return m_Commands; }
+		inline uint32_t GetQuadCount() const { return (uint32_t)(m_Vertices.size() / 4); }
+
+		Renderer2DStats GetStats() const;
+
+		static uint32_t PackColor(const glm::vec4& color);
+	private:
+		// Corners in order top left, top right, bottom right, bottom left
+		void PushQuad(const glm::vec2 (&corners)[4], const glm::vec2& uvMin, const glm::vec2& uvMax, uint32_t color, uint32_t textureID,
+			const glm::vec2& halfSize = glm::vec2(0.0f), float radius = 0.0f);
+
+		std::vector<Batch2DVertex> m_Vertices;
+		std::vector<Batch2DCommand> m_Commands;
+	};
+
+}
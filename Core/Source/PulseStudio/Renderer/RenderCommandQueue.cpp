@@ -0,0 +1,31 @@
+#include "pspch.h"
+#include "RenderCommandQueue.h"
+
+namespace PulseStudio {
+
+	RenderCommandQueue::RenderCommandQueue()
+	{
+		m_Commands.reserve(1024);
+	}
+
+	RenderCommandQueue::~RenderCommandQueue()
+	{
+		Clear();
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		for (const Command& command : m_Commands)
+			command.Execute(command.Payload);
+	}
+
+	void RenderCommandQueue::Clear()
+	{
+		for (const Command& command : m_Commands)
+			command.Destroy(command.Payload);
+		m_Commands.clear();
+
+		m_Arena.Reset();
+	}
+
+}
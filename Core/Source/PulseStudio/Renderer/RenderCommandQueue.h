@@ -0,0 +1,55 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "PulseStudio/Memory/LinearArena.h"
+
+namespace PulseStudio {
+
+	/*
+	* Recorded render work for one frame. Submit() stores the callable in a LinearArena and a
+	* (execute, destroy, payload) triple in a flat array, so recording does not allocate once the
+	* blocks have grown to the frame's size. A queue can be executed any number of times (the render
+	* thread replays the last frame while a resize is in progress), Clear() destroys the commands
+	* and keeps the memory for the next frame.
+	*/
+	class RenderCommandQueue
+	{
+	public:
+		RenderCommandQueue();
+		~RenderCommandQueue();
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		template<typename F>
+		void Submit(F&& func)
+		{
+			using Fn = std::decay_t<F>;
+			void* payload = m_Arena.Allocate(sizeof(Fn), alignof(Fn));
+			new (payload) Fn(std::forward<F>(func));
+
+			Command command;
+			command.Execute = [](void* fn) { (*static_cast<Fn*>(fn))(); };
+			command.Destroy = [](void* fn) { static_cast<Fn*>(fn)->~Fn(); };
+			command.Payload = payload;
+			m_Commands.push_back(command);
+		}
+
+		void Execute();
+		void Clear();
+
+		inline size_t GetCommandCount() const { return m_Commands.size(); }
+	private:
+		struct Command
+		{
+			void (*Execute)(void*);
+			void (*Destroy)(void*);
+			void* Payload;
+		};
+
+		std::vector<Command> m_Commands;
+		LinearArena m_Arena;
+	};
+
+}
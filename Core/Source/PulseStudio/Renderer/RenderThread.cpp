@@ -0,0 +1,148 @@
+#include "pspch.h"
+#include "RenderThread.h"
+
+#include "PulseStudio/Window.h"
+#include "PulseStudio/Profiler.h"
+
+#include <glad/glad.h>
+
+namespace PulseStudio {
+
+	RenderThread::~RenderThread()
+	{
+		Stop();
+	}
+
+	void RenderThread::Start(Window* window, RenderThreadMode mode)
+	{
+		Stop();
+
+		m_Window = window;
+		m_Mode = mode;
+		m_WriteIndex = 0;
+		m_FramePending = false;
+		m_HasFrame = false;
+
+		if (m_Mode == RenderThreadMode::Inline)
+			return;
+
+		// The context can only be current on one thread, hand it over
+		m_Window->SetContextCurrent(false);
+		m_Running = true;
+		m_Thread = std::thread(&RenderThread::RenderLoop, this);
+		PS_CORE_INFO("Render thread started.");
+	}
+
+	void RenderThread::Stop()
+	{
+		if (!m_Window)
+			return;
+
+		if (m_Thread.joinable())
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Running = false;
+			}
+			m_Condition.notify_all();
+			m_Thread.join();
+
+			// The render thread released the context on exit, take it back
+			m_Window->SetContextCurrent(true);
+			PS_CORE_INFO("Render thread stopped.");
+		}
+
+		m_Queues[0].Clear();
+		m_Queues[1].Clear();
+		m_OnceQueues[0].Clear();
+		m_OnceQueues[1].Clear();
+		m_Window = nullptr;
+	}
+
+	void RenderThread::EndFrame()
+	{
+		if (m_Mode == RenderThreadMode::Inline)
+		{
+			ApplyPendingResize();
+			m_OnceQueues[m_WriteIndex].Execute();
+			m_Queues[m_WriteIndex].Execute();
+			m_Window->SwapBuffers();
+			m_OnceQueues[m_WriteIndex].Clear();
+			m_Queues[m_WriteIndex].Clear();
+			return;
+		}
+
+		{
+			// Wait for the previous frame to be consumed, then publish this one
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Condition.wait(lock, [this]() { return !m_FramePending && !m_Executing; });
+			m_WriteIndex ^= 1;
+			m_FramePending = true;
+		}
+		m_Condition.notify_all();
+
+		// The render thread no longer references the frame before last
+		m_OnceQueues[m_WriteIndex].Clear();
+		m_Queues[m_WriteIndex].Clear();
+	}
+
+	void RenderThread::NotifyResize(uint32_t width, uint32_t height)
+	{
+		m_Width = width;
+		m_Height = height;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_ResizePending = true;
+		}
+		m_Condition.notify_all();
+	}
+
+	void RenderThread::RenderLoop()
+	{
+		Profiler::SetThreadName("Render");
+		PS_MEMORY_TAG(Renderer);
+		m_Window->SetContextCurrent(true);
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		for (;;)
+		{
+			m_Condition.wait(lock, [this]() { return m_FramePending || !m_Running || (m_ResizePending && m_HasFrame); });
+			if (!m_Running)
+				break;
+
+			// A new frame, or the last one again at the new size
+			bool newFrame = m_FramePending;
+			RenderCommandQueue& onceQueue = m_OnceQueues[m_WriteIndex ^ 1];
+			RenderCommandQueue& queue = m_Queues[m_WriteIndex ^ 1];
+			m_Executing = true;
+			lock.unlock();
+
+			{
+				PS_PROFILE_SCOPE(newFrame ? "RenderThread::Execute" : "RenderThread::Repaint");
+				m_Repainting = !newFrame;
+				ApplyPendingResize();
+				if (newFrame)
+					onceQueue.Execute();
+				queue.Execute();
+				m_Window->SwapBuffers();
+			}
+
+			lock.lock();
+			m_Executing = false;
+			if (newFrame)
+				m_FramePending = false;
+			m_HasFrame = true;
+			m_Condition.notify_all();
+		}
+		lock.unlock();
+
+		m_Window->SetContextCurrent(false);
+	}
+
+	void RenderThread::ApplyPendingResize()
+	{
+		if (m_ResizePending.exchange(false))
+			glViewport(0, 0, (GLsizei)m_Width.load(), (GLsizei)m_Height.load());
+	}
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "RenderCommandQueue.h"
+
+#include <condition_variable>
+
+namespace PulseStudio {
+
+	class Window;
+
+	enum class RenderThreadMode
+	{
+		Inline = 0,	// Execute and present on the update thread at EndFrame (debugging, single-threaded drivers)
+		Threaded	// A dedicated render thread owns the GL context and presents completed frames
+	};
+
+	/*
+	* Double-buffered hand-off between the update thread and the render thread. The update thread
+	* records GL work with Submit() while the render thread executes and presents the previous frame,
+	* EndFrame() swaps the two command queues. At most one frame is in flight, so EndFrame() only
+	* blocks when rendering is slower than updating.
+	* When the window is resized while the update thread is busy (or stuck in the OS resize loop),
+	* the render thread re-executes the last completed frame at the new size so the window stays
+	* painted. Work submitted with SubmitOnce() runs before the frame's commands and is not part of
+	* that repaint.
+	* In Threaded mode all GL calls must go through Submit() or SubmitOnce().
+	*/
+	class RenderThread
+	{
+	public:
+		RenderThread() = default;
+		~RenderThread();
+
+		RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+
+		void Start(Window* window, RenderThreadMode mode);
+		void Stop();
+
+		inline bool IsRunning() const { return m_Window != nullptr; }
+		inline RenderThreadMode GetMode() const { return m_Mode; }
+
+		// Record GL work for the frame being built, update thread only
+		template<typename F>
+		void Submit(F&& func)
+		{
+			m_Queues[m_WriteIndex].Submit(std::forward<F>(func));
+		}
+
+		// Record GL work that must run exactly once (creating and destroying resources, context
+		// state) ahead of the frame being built, a resize repaint does not run it again
+		template<typename F>
+		void SubmitOnce(F&& func)
+		{
+			m_OnceQueues[m_WriteIndex].Submit(std::forward<F>(func));
+		}
+
+		// Hand the recorded frame over to be executed and presented
+		void EndFrame();
+
+		// Called from the window callback, may run while the update thread is blocked
+		void NotifyResize(uint32_t width, uint32_t height);
+
+		// True while the render thread re-executes the last frame at a new size, for commands that
+		// must repaint the whole window then (a partial-redraw scissor no longer fits it)
+		inline bool IsRepainting() const { return m_Repainting; }
+	private:
+		void RenderLoop();
+		void ApplyPendingResize();
+
+		Window* m_Window = nullptr;
+		RenderThreadMode m_Mode = RenderThreadMode::Threaded;
+		std::thread m_Thread;
+
+		std::array<RenderCommandQueue, 2> m_Queues;
+		std::array<RenderCommandQueue, 2> m_OnceQueues;
+		uint32_t m_WriteIndex = 0;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		bool m_Running = false;
+		bool m_FramePending = false;
+		bool m_Executing = false;
+		bool m_HasFrame = false;
+		bool m_Repainting = false;	// Render thread only
+
+		std::atomic<bool> m_ResizePending = false;
+		std::atomic<uint32_t> m_Width = 0;
+		std::atomic<uint32_t> m_Height = 0;
+	};
+
+}
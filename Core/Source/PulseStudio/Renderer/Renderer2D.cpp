@@ -0,0 +1,463 @@
+#include "pspch.h"
+#include "Renderer2D.h"
+
+#include "RenderThread.h"
+#include "PulseStudio/Profiler.h"
+#include "PulseStudio/Memory/Memory.h"
+
+#include <glad/glad.h>
+#include <bit>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace PulseStudio {
+
+	// Vertex buffer regions in flight, one being written while the GPU may still read two
+	static constexpr uint32_t s_RegionCount = 3;
+	static constexpr uint32_t s_InitialRegionQuads = 16 * 1024;
+
+	static const char* s_VertexShader = R"(
+		#version 460 core
+
+		layout(location = 0) in vec2 a_Position;
+		layout(location = 1) in vec2 a_TexCoord;
+		layout(location = 2) in vec4 a_Color;
+		layout(location = 3) in vec2 a_Local;
+		layout(location = 4) in vec3 a_Shape;
+
+		uniform mat4 u_Projection;
+
+		out vec2 v_TexCoord;
+		out vec4 v_Color;
+		out vec2 v_Local;
+		out vec3 v_Shape;
+
+		void main()
+		{
+			v_TexCoord = a_TexCoord;
+			v_Color = a_Color;
+			v_Local = a_Local;
+			v_Shape = a_Shape;
+			gl_Position = u_Projection * vec4(a_Position, 0.0, 1.0);
+		}
+	)";
+
+	static const char* s_FragmentShader = R"(
+		#version 460 core
+
+		in vec2 v_TexCoord;
+		in vec4 v_Color;
+		in vec2 v_Local;
+		in vec3 v_Shape;
+
+		layout(binding = 0) uniform sampler2D u_Texture;
+
+		out vec4 o_Color;
+
+		void main()
+		{
+			vec4 texel = texture(u_Texture, v_TexCoord);
+			float radius = v_Shape.z;
+
+			// Distance field glyph: outline at 0.5, one screen pixel of antialiasing whatever the scale
+			if (radius < 0.0)
+			{
+				float field = texel.a;
+				texel.a = clamp((field - 0.5) / max(fwidth(field), 1e-4) + 0.5, 0.0, 1.0);
+			}
+
+			vec4 color = texel * v_Color;
+
+			// Rounded box distance, one pixel of antialiasing along the edge
+			if (radius > 0.0)
+			{
+				vec2 q = abs(v_Local) - v_Shape.xy + radius;
+				float distance = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius;
+				color.a *= clamp(0.5 - distance, 0.0, 1.0);
+			}
+
+			if (color.a <= 0.0)
+				discard;
+			o_Color = color;
+		}
+	)";
+
+	// GL objects, touched only on the thread that owns the context
+	struct Renderer2DGpu
+	{
+		GLuint VertexArray = 0;
+		GLuint VertexBuffer = 0;
+		GLuint IndexBuffer = 0;
+		GLuint Program = 0;
+		GLuint WhiteTexture = 0;
+		GLint ProjectionLocation = -1;
+
+		// GL names by Renderer2D texture handle
+		std::vector<GLuint> Textures;
+
+		Batch2DVertex* Mapped = nullptr;
+		uint32_t RegionQuads = 0;
+		uint32_t Region = 0;
+		std::array<GLsync, s_RegionCount> Fences = {};
+	};
+
+	struct Renderer2D::Data
+	{
+		RenderThread* Thread = nullptr;
+
+		std::array<Batch2D, 2> Batches;
+		uint32_t BatchIndex = 0;
+		std::array<glm::mat4, 2> Projections;
+
+		Renderer2DStats Stats;
+		// Format by texture handle, handle 0 is the white texture
+		std::vector<TextureFormat> TextureFormats = { TextureFormat::RGBA8 };
+		Renderer2DGpu Gpu;
+	};
+
+	Renderer2D::Data* Renderer2D::s_Data = nullptr;
+
+	static GLuint CompileShader(GLenum type, const char* source)
+	{
+		GLuint shader = glCreateShader(type);
+		glShaderSource(shader, 1, &source, nullptr);
+		glCompileShader(shader);
+
+		GLint status = GL_TRUE;
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+		if (status == GL_FALSE)
+		{
+			char log[1024] = {};
+			glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+			PS_CORE_ERROR("Renderer2D shader failed to compile: {0}", log);
+		}
+		return shader;
+	}
+
+	static GLuint CreateProgram()
+	{
+		GLuint vertex = CompileShader(GL_VERTEX_SHADER, s_VertexShader);
+		GLuint fragment = CompileShader(GL_FRAGMENT_SHADER, s_FragmentShader);
+
+		GLuint program = glCreateProgram();
+		glAttachShader(program, vertex);
+		glAttachShader(program, fragment);
+		glLinkProgram(program);
+
+		GLint status = GL_TRUE;
+		glGetProgramiv(program, GL_LINK_STATUS, &status);
+		if (status == GL_FALSE)
+		{
+			char log[1024] = {};
+			glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+			PS_CORE_ERROR("Renderer2D shader failed to link: {0}", log);
+		}
+
+		glDeleteShader(vertex);
+		glDeleteShader(fragment);
+		return program;
+	}
+
+	static void DestroyBuffers(Renderer2DGpu& gpu)
+	{
+		for (GLsync& fence : gpu.Fences)
+		{
+			if (fence)
+				glDeleteSync(fence);
+			fence = nullptr;
+		}
+
+		if (gpu.VertexBuffer)
+		{
+			glUnmapNamedBuffer(gpu.VertexBuffer);
+			glDeleteBuffers(1, &gpu.VertexBuffer);
+		}
+		if (gpu.IndexBuffer)
+			glDeleteBuffers(1, &gpu.IndexBuffer);
+
+		gpu.VertexBuffer = 0;
+		gpu.IndexBuffer = 0;
+		gpu.Mapped = nullptr;
+		gpu.RegionQuads = 0;
+	}
+
+	// Size the ring for at least regionQuads quads per frame
+	static void CreateBuffers(Renderer2DGpu& gpu, uint32_t regionQuads)
+	{
+		if (gpu.VertexBuffer)
+		{
+			// Only when a frame outgrows the ring, drain the GPU instead of tracking old buffers
+			glFinish();
+			DestroyBuffers(gpu);
+		}
+
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		GLsizeiptr vertexBytes = (GLsizeiptr)s_RegionCount * regionQuads * 4 * sizeof(Batch2DVertex);
+		glCreateBuffers(1, &gpu.VertexBuffer);
+		glNamedBufferStorage(gpu.VertexBuffer, vertexBytes, nullptr, flags);
+		gpu.Mapped = static_cast<Batch2DVertex*>(glMapNamedBufferRange(gpu.VertexBuffer, 0, vertexBytes, flags));
+
+		// Indices address quads within one region, the region is selected with the base vertex
+		std::vector<uint32_t> indices((size_t)regionQuads * 6);
+		for (uint32_t quad = 0; quad < regionQuads; quad++)
+		{
+			uint32_t vertex = quad * 4;
+			uint32_t* index = &indices[(size_t)quad * 6];
+			index[0] = vertex + 0; index[1] = vertex + 1; index[2] = vertex + 2;
+			index[3] = vertex + 2; index[4] = vertex + 3; index[5] = vertex + 0;
+		}
+		glCreateBuffers(1, &gpu.IndexBuffer);
+		glNamedBufferStorage(gpu.IndexBuffer, (GLsizeiptr)(indices.size() * sizeof(uint32_t)), indices.data(), 0);
+
+		glVertexArrayVertexBuffer(gpu.VertexArray, 0, gpu.VertexBuffer, 0, sizeof(Batch2DVertex));
+		glVertexArrayElementBuffer(gpu.VertexArray, gpu.IndexBuffer);
+
+		gpu.RegionQuads = regionQuads;
+		gpu.Region = 0;
+	}
+
+	static void SetupAttribute(GLuint vertexArray, GLuint location, GLint count, GLenum type, GLboolean normalized, size_t offset)
+	{
+		glEnableVertexArrayAttrib(vertexArray, location);
+		glVertexArrayAttribFormat(vertexArray, location, count, type, normalized, (GLuint)offset);
+		glVertexArrayAttribBinding(vertexArray, location, 0);
+	}
+
+	static void CreateResources(Renderer2DGpu& gpu)
+	{
+		glCreateVertexArrays(1, &gpu.VertexArray);
+		SetupAttribute(gpu.VertexArray, 0, 2, GL_FLOAT, GL_FALSE, offsetof(Batch2DVertex, Position));
+		SetupAttribute(gpu.VertexArray, 1, 2, GL_FLOAT, GL_FALSE, offsetof(Batch2DVertex, TexCoord));
+		SetupAttribute(gpu.VertexArray, 2, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(Batch2DVertex, Color));
+		SetupAttribute(gpu.VertexArray, 3, 2, GL_FLOAT, GL_FALSE, offsetof(Batch2DVertex, Local));
+		SetupAttribute(gpu.VertexArray, 4, 3, GL_FLOAT, GL_FALSE, offsetof(Batch2DVertex, Shape));
+
+		CreateBuffers(gpu, s_InitialRegionQuads);
+
+		gpu.Program = CreateProgram();
+		gpu.ProjectionLocation = glGetUniformLocation(gpu.Program, "u_Projection");
+
+		uint32_t white = 0xFFFFFFFF;
+		glCreateTextures(GL_TEXTURE_2D, 1, &gpu.WhiteTexture);
+		glTextureStorage2D(gpu.WhiteTexture, 1, GL_RGBA8, 1, 1);
+		glTextureSubImage2D(gpu.WhiteTexture, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+	}
+
+	static void DestroyResources(Renderer2DGpu& gpu)
+	{
+		for (GLuint texture : gpu.Textures)
+		{
+			if (texture)
+				glDeleteTextures(1, &texture);
+		}
+
+		DestroyBuffers(gpu);
+		if (gpu.VertexArray)
+			glDeleteVertexArrays(1, &gpu.VertexArray);
+		if (gpu.Program)
+			glDeleteProgram(gpu.Program);
+		if (gpu.WhiteTexture)
+			glDeleteTextures(1, &gpu.WhiteTexture);
+		gpu = Renderer2DGpu();
+	}
+
+	static void Flush(Renderer2DGpu& gpu, const Batch2D& batch, const glm::mat4& projection)
+	{
+		PS_PROFILE_FUNCTION();
+
+		uint32_t quads = batch.GetQuadCount();
+		if (quads > gpu.RegionQuads)
+			CreateBuffers(gpu, std::bit_ceil(quads));
+		if (!gpu.Mapped)
+			return;
+
+		// The region was last used three flushes ago, normally long finished
+		GLsync& fence = gpu.Fences[gpu.Region];
+		if (fence)
+		{
+			while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED)
+			{
+			}
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+
+		GLint baseVertex = (GLint)(gpu.Region * gpu.RegionQuads * 4);
+		std::memcpy(gpu.Mapped + baseVertex, batch.GetVertices().data(), batch.GetVertices().size() * sizeof(Batch2DVertex));
+
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		glUseProgram(gpu.Program);
+		glUniformMatrix4fv(gpu.ProjectionLocation, 1, GL_FALSE, glm::value_ptr(projection));
+		glBindVertexArray(gpu.VertexArray);
+
+		for (const Batch2DCommand& command : batch.GetCommands())
+		{
+			GLuint texture = command.TextureID < gpu.Textures.size() ? gpu.Textures[command.TextureID] : 0;
+			glBindTextureUnit(0, texture ? texture : gpu.WhiteTexture);
+			glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)(command.QuadCount * 6), GL_UNSIGNED_INT,
+				(const void*)((uintptr_t)command.FirstQuad * 6 * sizeof(uint32_t)), baseVertex);
+		}
+
+		glBindVertexArray(0);
+		glUseProgram(0);
+		glDisable(GL_BLEND);
+
+		fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		gpu.Region = (gpu.Region + 1) % s_RegionCount;
+	}
+
+	void Renderer2D::Init(RenderThread& renderThread)
+	{
+		PS_CORE_ASSERT(!s_Data, "Renderer2D already initialized!");
+
+		s_Data = new Data();
+		s_Data->Thread = &renderThread;
+
+		Renderer2DGpu* gpu = &s_Data->Gpu;
+		renderThread.SubmitOnce([gpu]() { CreateResources(*gpu); });
+	}
+
+	void Renderer2D::Shutdown()
+	{
+		if (!s_Data)
+			return;
+
+		DestroyResources(s_Data->Gpu);
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void Renderer2D::BeginFrame(uint32_t width, uint32_t height)
+	{
+		// Pixel coordinates with the origin in the top left corner
+		s_Data->Projections[s_Data->BatchIndex] = glm::ortho(0.0f, (float)width, (float)height, 0.0f, -1.0f, 1.0f);
+
+		// This batch was read by the frame before last, which the render thread has finished
+		s_Data->Batches[s_Data->BatchIndex].Clear();
+	}
+
+	void Renderer2D::EndFrame()
+	{
+		PS_PROFILE_FUNCTION();
+
+		uint32_t index = s_Data->BatchIndex;
+		const Batch2D& batch = s_Data->Batches[index];
+		s_Data->Stats = batch.GetStats();
+
+		Profiler::RecordCounter("Renderer2D draw calls", s_Data->Stats.DrawCalls);
+		Profiler::RecordCounter("Renderer2D vertices", s_Data->Stats.Vertices);
+
+		if (batch.GetQuadCount() > 0)
+		{
+			Renderer2DGpu* gpu = &s_Data->Gpu;
+			const glm::mat4* projection = &s_Data->Projections[index];
+			s_Data->Thread->Submit([gpu, &batch, projection]() { Flush(*gpu, batch, *projection); });
+		}
+
+		s_Data->BatchIndex ^= 1;
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
+	{
+		GetBatch().DrawQuad(position, size, color);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const TextureRegion& region, const glm::vec4& tint)
+	{
+		GetBatch().DrawQuad(position, size, region, tint);
+	}
+
+	void Renderer2D::DrawLine(const glm::vec2& from, const glm::vec2& to, float thickness, const glm::vec4& color)
+	{
+		GetBatch().DrawLine(from, to, thickness, color);
+	}
+
+	void Renderer2D::DrawRoundedRect(const glm::vec2& position, const glm::vec2& size, float radius, const glm::vec4& color)
+	{
+		GetBatch().DrawRoundedRect(position, size, radius, color);
+	}
+
+	void Renderer2D::DrawDistanceField(const glm::vec2& position, const glm::vec2& size, const TextureRegion& region, const glm::vec4& color)
+	{
+		GetBatch().DrawDistanceField(position, size, region, color);
+	}
+
+	uint32_t Renderer2D::CreateTexture(uint32_t width, uint32_t height, TextureFormat format)
+	{
+		uint32_t handle = (uint32_t)s_Data->TextureFormats.size();
+		s_Data->TextureFormats.push_back(format);
+
+		Renderer2DGpu* gpu = &s_Data->Gpu;
+		s_Data->Thread->SubmitOnce([gpu, handle, width, height, format]()
+			{
+				if (gpu->Textures.size() <= handle)
+					gpu->Textures.resize(handle + 1, 0);
+
+				GLuint& texture = gpu->Textures[handle];
+				glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+				glTextureStorage2D(texture, 1, format == TextureFormat::R8 ? GL_R8 : GL_RGBA8, (GLsizei)width, (GLsizei)height);
+				glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+				glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+				glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+				glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+				if (format == TextureFormat::R8)
+				{
+					GLint swizzle[4] = { GL_ONE, GL_ONE, GL_ONE, GL_RED };
+					glTextureParameteriv(texture, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+				}
+			});
+		return handle;
+	}
+
+	void Renderer2D::UpdateTexture(uint32_t texture, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels, uint32_t rowLength)
+	{
+		if (texture == 0 || texture >= s_Data->TextureFormats.size() || width == 0 || height == 0)
+			return;
+
+		// Frame memory stays valid until the render thread is done with this frame
+		TextureFormat format = s_Data->TextureFormats[texture];
+		size_t pixelSize = format == TextureFormat::R8 ? 1 : 4;
+		size_t rowSize = (size_t)width * pixelSize;
+		size_t sourceStride = (rowLength ? rowLength : width) * pixelSize;
+		uint8_t* copy = static_cast<uint8_t*>(Memory::GetFrameArena().Allocate(rowSize * height, 4));
+		for (uint32_t row = 0; row < height; row++)
+			std::memcpy(copy + row * rowSize, static_cast<const uint8_t*>(pixels) + row * sourceStride, rowSize);
+
+		Renderer2DGpu* gpu = &s_Data->Gpu;
+		s_Data->Thread->Submit([gpu, texture, x, y, width, height, format, copy]()
+			{
+				if (texture >= gpu->Textures.size() || !gpu->Textures[texture])
+					return;
+
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+				glTextureSubImage2D(gpu->Textures[texture], 0, (GLint)x, (GLint)y, (GLsizei)width, (GLsizei)height,
+					format == TextureFormat::R8 ? GL_RED : GL_RGBA, GL_UNSIGNED_BYTE, copy);
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+			});
+	}
+
+	void Renderer2D::DestroyTexture(uint32_t texture)
+	{
+		Renderer2DGpu* gpu = &s_Data->Gpu;
+		s_Data->Thread->SubmitOnce([gpu, texture]()
+			{
+				if (texture < gpu->Textures.size() && gpu->Textures[texture])
+				{
+					glDeleteTextures(1, &gpu->Textures[texture]);
+					gpu->Textures[texture] = 0;
+				}
+			});
+	}
+
+	Batch2D& Renderer2D::GetBatch()
+	{
+		return s_Data->Batches[s_Data->BatchIndex];
+	}
+
+	const Renderer2DStats& Renderer2D::GetStats()
+	{
+		return s_Data->Stats;
+	}
+
+}
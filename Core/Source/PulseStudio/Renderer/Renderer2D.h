@@ -0,0 +1,63 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "Batch2D.h"
+
+namespace PulseStudio {
+
+	class RenderThread;
+
+	enum class TextureFormat
+	{
+		RGBA8 = 0,
+		R8		// Single channel coverage (glyphs), samples as white with the value in alpha
+	};
+
+	/*
+	* Batched 2D renderer. Shapes drawn during a frame are collected in a Batch2D on the update
+	* thread and EndFrame() submits a single flush to the render thread, which copies the vertices
+	* into a persistently mapped vertex buffer and issues one indexed draw per texture run.
+	* The vertex buffer is split into three regions used round-robin and guarded by fences, so the
+	* CPU never writes into memory the GPU may still be reading and never waits in steady state.
+	* There are two CPU batches: the render thread reads one while the next frame fills the other.
+	*/
+	class Renderer2D
+	{
+	public:
+		// GL setup is submitted to the render thread, call after RenderThread::Start
+		static void Init(RenderThread& renderThread);
+		// Call after RenderThread::Stop, when the context is back on the calling thread
+		static void Shutdown();
+
+		static inline bool IsInitialized() { return s_Data != nullptr; }
+
+		// Update thread, after the frame's clear and before RenderThread::EndFrame
+		static void BeginFrame(uint32_t width, uint32_t height);
+		static void EndFrame();
+
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const TextureRegion& region, const glm::vec4& tint = glm::vec4(1.0f));
+		static void DrawLine(const glm::vec2& from, const glm::vec2& to, float thickness, const glm::vec4& color);
+		static void DrawRoundedRect(const glm::vec2& position, const glm::vec2& size, float radius, const glm::vec4& color);
+		static void DrawDistanceField(const glm::vec2& position, const glm::vec2& size, const TextureRegion& region, const glm::vec4& color);
+
+		// Textures are created and updated through the render thread, the returned handle can be
+		// drawn with right away. Pixels are copied; rowLength is the source row in pixels, 0 when
+		// rows are tightly packed. Creation and destruction run once ahead of the frame's draws
+		// (RenderThread::SubmitOnce), so a texture is not drawn in the frame that destroys it.
+		static uint32_t CreateTexture(uint32_t width, uint32_t height, TextureFormat format);
+		static void UpdateTexture(uint32_t texture, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* pixels, uint32_t rowLength = 0);
+		static void DestroyTexture(uint32_t texture);
+
+		// The batch of the frame being built
+		static Batch2D& GetBatch();
+
+		// Counts of the last submitted frame
+		static const Renderer2DStats& GetStats();
+	private:
+		struct Data;
+		static Data* s_Data;
+	};
+
+}
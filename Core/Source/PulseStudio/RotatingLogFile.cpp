@@ -0,0 +1,393 @@
+#include "pspch.h"
+
+#include "RotatingLogFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Size of a segment without its zero padding, scanning back from the end
+static uintmax_t findWrittenSize(const std::string& path)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+    std::streamoff end = file.tellg();
+    char buffer[64 * 1024];
+
+    while (end > 0)
+    {
+        std::streamoff chunk = std::min<std::streamoff>(end, sizeof(buffer));
+        file.seekg(end - chunk);
+        file.read(buffer, chunk);
+
+        for (std::streamoff i = chunk; i > 0; --i)
+        {
+            if (buffer[i - 1] != '\0')
+            {
+                return (uintmax_t)(end - chunk + i);
+            }
+        }
+        end -= chunk;
+    }
+
+    return 0;
+}
+
+// Destructor
+RotatingLogFile::~RotatingLogFile()
+{
+    close();
+}
+
+// Open the active segment
+bool RotatingLogFile::open(const std::string& path, const LogRotationSettings& settings)
+{
+    close();
+
+    m_path = path;
+    m_settings = settings;
+
+    // A segment from a previous session may still be padded to full size (or
+    // the process crashed), keep only what was written and move it aside
+    namespace fs = std::filesystem;
+    std::error_code error;
+    if (fs::exists(m_path, error))
+    {
+        fs::resize_file(m_path, findWrittenSize(m_path), error);
+        archiveActiveSegment();
+        pruneSegmentsAsync();
+    }
+
+    return openSegment();
+}
+
+// Append bytes, rotating as often as needed
+void RotatingLogFile::write(const char* data, size_t size)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    if (m_settings.maxAge.count() > 0 && m_offset > 0
+        && std::chrono::steady_clock::now() - m_segmentOpened >= m_settings.maxAge)
+    {
+        rotate();
+    }
+
+    while (size > 0 && isOpen())
+    {
+        size_t available = m_settings.segmentSize - m_offset;
+        size_t chunk = size;
+        if (size > available)
+        {
+            // Fill the segment with the lines that fit, the rest starts the next one
+            std::string_view fits(data, available);
+            size_t lineEnd = fits.rfind('\n');
+            chunk = lineEnd == std::string_view::npos ? 0 : lineEnd + 1;
+            if (chunk == 0 && m_offset > 0)
+            {
+                rotate();
+                continue;
+            }
+
+            // A line longer than a whole segment has to be split
+            if (chunk == 0)
+            {
+                chunk = available;
+            }
+        }
+
+        append(data, chunk);
+        data += chunk;
+        size -= chunk;
+
+        if (m_offset == m_settings.segmentSize || size > 0)
+        {
+            rotate();
+        }
+    }
+
+    if (m_fallbackFile.is_open())
+    {
+        m_fallbackFile.flush();
+    }
+}
+
+// Copy into the mapping, or into the fallback stream
+void RotatingLogFile::append(const char* data, size_t size)
+{
+    if (m_view)
+    {
+        std::memcpy(m_view + m_offset, data, size);
+    }
+    else
+    {
+        m_fallbackFile.write(data, (std::streamsize)size);
+    }
+    m_offset += size;
+}
+
+// Unmap and trim the active segment
+void RotatingLogFile::close()
+{
+    unmapSegment();
+    stopPruneThread();
+}
+
+// Map a new segment, or keep logging through a buffered stream when mapping fails
+bool RotatingLogFile::openSegment()
+{
+    if (mapSegment())
+    {
+        return true;
+    }
+
+    std::cerr << "Writing log segment " << m_path << " through a buffered stream instead" << std::endl;
+    m_fallbackFile.open(m_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_fallbackFile.is_open())
+    {
+        std::cerr << "Failed to open log file: " << m_path << std::endl;
+        return false;
+    }
+
+    m_offset = 0;
+    m_segmentOpened = std::chrono::steady_clock::now();
+    return true;
+}
+
+// Create the active segment at full size and map it
+bool RotatingLogFile::mapSegment()
+{
+    size_t size = m_settings.segmentSize;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(m_path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+        CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        std::cerr << "Failed to open log segment: " << m_path << std::endl;
+        return false;
+    }
+
+    // Creating the mapping extends the file to the segment size
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+        (DWORD)((uint64_t)size >> 32), (DWORD)((uint64_t)size & 0xFFFFFFFF), nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size) : nullptr;
+    if (!view)
+    {
+        std::cerr << "Failed to map log segment: " << m_path << std::endl;
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_fileHandle = file;
+    m_mappingHandle = mapping;
+#else
+    int fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        std::cerr << "Failed to open log segment: " << m_path << std::endl;
+        return false;
+    }
+
+    void* view = MAP_FAILED;
+    if (::ftruncate(fd, (off_t)size) == 0)
+    {
+        view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (view == MAP_FAILED)
+    {
+        std::cerr << "Failed to map log segment: " << m_path << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    m_fileDescriptor = fd;
+#endif
+
+    m_view = static_cast<char*>(view);
+    m_offset = 0;
+    m_segmentOpened = std::chrono::steady_clock::now();
+    return true;
+}
+
+// Unmap the active segment and cut off the unused tail
+void RotatingLogFile::unmapSegment()
+{
+    if (m_fallbackFile.is_open())
+    {
+        m_fallbackFile.close();
+    }
+
+    if (!m_view)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_view);
+    CloseHandle((HANDLE)m_mappingHandle);
+
+    LARGE_INTEGER end;
+    end.QuadPart = (LONGLONG)m_offset;
+    SetFilePointerEx((HANDLE)m_fileHandle, end, nullptr, FILE_BEGIN);
+    SetEndOfFile((HANDLE)m_fileHandle);
+    CloseHandle((HANDLE)m_fileHandle);
+
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+#else
+    ::munmap(m_view, m_settings.segmentSize);
+    if (::ftruncate(m_fileDescriptor, (off_t)m_offset) != 0)
+    {
+        std::cerr << "Failed to trim log segment: " << m_path << std::endl;
+    }
+    ::close(m_fileDescriptor);
+
+    m_fileDescriptor = -1;
+#endif
+
+    m_view = nullptr;
+}
+
+// Close the full segment and start a new one
+void RotatingLogFile::rotate()
+{
+    unmapSegment();
+    archiveActiveSegment();
+    pruneSegmentsAsync();
+    openSegment();
+}
+
+// Move a closed segment out of the way under a timestamped name
+void RotatingLogFile::archiveActiveSegment()
+{
+    namespace fs = std::filesystem;
+
+    fs::path active(m_path);
+    std::error_code error;
+    if (!fs::exists(active, error) || fs::file_size(active, error) == 0)
+    {
+        return;
+    }
+
+    // std::localtime shares one buffer between threads, and the logger rotates from its writer
+    std::time_t time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm local{};
+#ifdef _WIN32
+    localtime_s(&local, &time);
+#else
+    localtime_r(&time, &local);
+#endif
+    std::stringstream stamp;
+    stamp << std::put_time(&local, "%Y%m%d-%H%M%S");
+
+    fs::path target;
+    for (int index = 0; ; ++index)
+    {
+        std::string name = active.stem().string() + "." + stamp.str();
+        if (index > 0)
+        {
+            name += '-';
+            name += std::to_string(index);
+        }
+        target = active.parent_path() / (name + active.extension().string());
+        if (!fs::exists(target, error))
+        {
+            break;
+        }
+    }
+
+    fs::rename(active, target, error);
+    if (error)
+    {
+        std::cerr << "Failed to rotate log segment: " << error.message() << std::endl;
+    }
+}
+
+// Ask the prune thread to delete rotated segments beyond maxSegments
+void RotatingLogFile::pruneSegmentsAsync()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pruneMutex);
+        m_prunePending = true;
+        m_pruneStop = false;
+    }
+
+    if (!m_pruneThread.joinable())
+    {
+        m_pruneThread = std::thread(&RotatingLogFile::pruneThread, this);
+    }
+    m_pruneCondition.notify_one();
+}
+
+// Delete old segments whenever a rotation asks for it, until close()
+void RotatingLogFile::pruneThread()
+{
+    namespace fs = std::filesystem;
+
+    fs::path active(m_path);
+    std::string prefix = active.stem().string() + ".";
+    std::string extension = active.extension().string();
+    fs::path directory = active.parent_path().empty() ? fs::path(".") : active.parent_path();
+    size_t maxSegments = m_settings.maxSegments;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_pruneMutex);
+            m_pruneCondition.wait(lock, [this]() { return m_prunePending || m_pruneStop; });
+            if (!m_prunePending)
+            {
+                return;
+            }
+            m_prunePending = false;
+        }
+
+        std::vector<std::pair<fs::file_time_type, fs::path>> segments;
+        std::error_code error;
+        for (const auto& entry : fs::directory_iterator(directory, error))
+        {
+            std::string name = entry.path().filename().string();
+            if (entry.path().filename() != active.filename() && name.starts_with(prefix)
+                && entry.path().extension().string() == extension)
+            {
+                segments.emplace_back(entry.last_write_time(error), entry.path());
+            }
+        }
+
+        if (segments.size() <= maxSegments)
+        {
+            continue;
+        }
+
+        // Oldest first, names break ties within the same second
+        std::sort(segments.begin(), segments.end());
+        for (size_t i = 0; i < segments.size() - maxSegments; ++i)
+        {
+            fs::remove(segments[i].second, error);
+        }
+    }
+}
+
+// Finish a pending prune and stop the thread
+void RotatingLogFile::stopPruneThread()
+{
+    if (!m_pruneThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_pruneMutex);
+        m_pruneStop = true;
+    }
+    m_pruneCondition.notify_one();
+    m_pruneThread.join();
+}
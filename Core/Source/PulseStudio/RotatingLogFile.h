@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Rotation limits for the text log file
+struct LogRotationSettings
+{
+    size_t segmentSize = 0;                         // Bytes per segment, 0 disables rotation
+    std::chrono::seconds maxAge{ 0 };               // Rotate a segment after this long, 0 disables
+    size_t maxSegments = 10;                        // Rotated segments kept next to the active one
+};
+
+// Log file written through a fixed-size memory-mapped segment.
+// Writes are plain memcpy's into the mapping, so there is no per-line flush
+// syscall and the data survives a crash in the page cache. When a segment is
+// full or too old it is trimmed, renamed to "<name>.<timestamp><ext>" and a new
+// segment is mapped; old segments are deleted on a background thread. A segment
+// only takes whole lines, unless a single line is longer than a segment. If a
+// segment cannot be mapped, that segment is written through a buffered stream.
+class RotatingLogFile
+{
+public:
+    RotatingLogFile() = default;
+    ~RotatingLogFile();
+
+    RotatingLogFile(const RotatingLogFile&) = delete;
+    RotatingLogFile& operator=(const RotatingLogFile&) = delete;
+
+    // Open the active segment, a segment left over from a previous session is rotated first
+    bool open(const std::string& path, const LogRotationSettings& settings);
+
+    // Append bytes, rotating as often as needed
+    void write(const char* data, size_t size);
+
+    // Unmap and trim the active segment to the bytes actually written
+    void close();
+
+    bool isOpen() const { return m_view != nullptr || m_fallbackFile.is_open(); }
+private:
+    // Map the next segment, or fall back to a buffered stream if that fails
+    bool openSegment();
+    bool mapSegment();
+    void unmapSegment();
+    void rotate();
+    void append(const char* data, size_t size);
+
+
+    // Move a closed segment out of the way under a timestamped name
+    void archiveActiveSegment();
+
+    // Ask the prune thread to delete rotated segments beyond maxSegments, never blocks
+    void pruneSegmentsAsync();
+    void pruneThread();
+    void stopPruneThread();
+
+    std::string m_path;
+    LogRotationSettings m_settings;
+    std::chrono::steady_clock::time_point m_segmentOpened;
+
+    char* m_view = nullptr;
+    size_t m_offset = 0;
+
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#else
+    int m_fileDescriptor = -1;
+#endif
+
+    std::ofstream m_fallbackFile;
+
+    // Prune requests coalesce, the thread deletes once for any number of rotations
+    std::thread m_pruneThread;
+    std::mutex m_pruneMutex;
+    std::condition_variable m_pruneCondition;
+    bool m_prunePending = false;
+    bool m_pruneStop = false;
+};
@@ -0,0 +1,345 @@
+#include "pspch.h"
+#include "Font.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_MODULE_H
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_truetype.h>
+
+namespace PulseStudio {
+
+	static std::atomic<uint32_t> s_NextFontID = 1;
+
+	// FreeType state of one thread. Faces are looked up by font ID with a linear scan, a thread
+	// only ever sees a handful of fonts.
+	struct ThreadFaces
+	{
+		struct Entry
+		{
+			uint32_t FontID = 0;
+			FT_Face Face = nullptr;
+			uint32_t PixelSize = 0;
+			std::shared_ptr<const std::vector<uint8_t>> Data;
+		};
+
+		FT_Library Library = nullptr;
+		bool LibraryFailed = false;
+		std::vector<Entry> Faces;
+
+		~ThreadFaces()
+		{
+			for (Entry& entry : Faces)
+				FT_Done_Face(entry.Face);
+			if (Library)
+				FT_Done_FreeType(Library);
+		}
+
+		Entry* Find(uint32_t fontID)
+		{
+			for (Entry& entry : Faces)
+			{
+				if (entry.FontID == fontID)
+					return &entry;
+			}
+			return nullptr;
+		}
+
+		Entry* Open(uint32_t fontID, const std::shared_ptr<const std::vector<uint8_t>>& data)
+		{
+			if (Entry* entry = Find(fontID))
+				return entry;
+
+			if (!Library && !LibraryFailed)
+			{
+				LibraryFailed = FT_Init_FreeType(&Library) != 0;
+				if (LibraryFailed)
+					PS_CORE_ERROR("Failed to initialize FreeType");
+
+				// Same spread for outline (sdf) and bitmap (bsdf) sourced distance fields
+				FT_Int spread = (FT_Int)Font::DistanceFieldSpread;
+				if (Library)
+				{
+					FT_Property_Set(Library, "sdf", "spread", &spread);
+					FT_Property_Set(Library, "bsdf", "spread", &spread);
+				}
+			}
+			if (!Library)
+				return nullptr;
+
+			FT_Face face = nullptr;
+			if (FT_New_Memory_Face(Library, data->data(), (FT_Long)data->size(), 0, &face) != 0)
+				return nullptr;
+
+			PS_MEMORY_TAG(Text);
+			Faces.push_back({ fontID, face, 0, data });
+			return &Faces.back();
+		}
+
+		void Close(uint32_t fontID)
+		{
+			std::erase_if(Faces, [fontID](Entry& entry)
+				{
+					if (entry.FontID != fontID)
+						return false;
+					FT_Done_Face(entry.Face);
+					return true;
+				});
+
+			// Leave nothing allocated once the thread is done with fonts
+			if (Faces.empty())
+				Faces.shrink_to_fit();
+		}
+	};
+
+	static thread_local ThreadFaces s_ThreadFaces;
+
+	// Face of this thread at the given pixel size, nullptr when FreeType cannot serve the font
+	static FT_Face GetThreadFace(uint32_t fontID, const std::shared_ptr<const std::vector<uint8_t>>& data, uint32_t pixelSize)
+	{
+		ThreadFaces::Entry* entry = s_ThreadFaces.Open(fontID, data);
+		if (!entry)
+			return nullptr;
+
+		if (pixelSize != 0 && entry->PixelSize != pixelSize)
+		{
+			if (FT_Set_Pixel_Sizes(entry->Face, 0, pixelSize) != 0)
+				return nullptr;
+			entry->PixelSize = pixelSize;
+		}
+		return entry->Face;
+	}
+
+	static void CopyBitmap(FT_GlyphSlot slot, GlyphBitmap& bitmap)
+	{
+		const FT_Bitmap& source = slot->bitmap;
+
+		bitmap.Width = source.width;
+		bitmap.Height = source.rows;
+		bitmap.BearingX = slot->bitmap_left;
+		bitmap.BearingY = slot->bitmap_top;
+		bitmap.Advance = slot->advance.x / 64.0f;
+		bitmap.Pixels.resize((size_t)bitmap.Width * bitmap.Height);
+
+		// Rows may be padded to the pitch, copy them one by one
+		for (uint32_t row = 0; row < bitmap.Height; row++)
+		{
+			const uint8_t* sourceRow = source.buffer + (ptrdiff_t)row * source.pitch;
+			std::memcpy(bitmap.Pixels.data() + (size_t)row * bitmap.Width, sourceRow, bitmap.Width);
+		}
+	}
+
+	static uint64_t HashBytes(const std::vector<uint8_t>& data)
+	{
+		uint64_t hash = 0xCBF29CE484222325ull;
+		for (uint8_t byte : data)
+			hash = (hash ^ byte) * 0x100000001B3ull;
+		return hash;
+	}
+
+	Font::~Font()
+	{
+		// Faces of other threads go away with those threads
+		s_ThreadFaces.Close(m_ID);
+	}
+
+	std::shared_ptr<Font> Font::Load(const std::string& path)
+	{
+		PS_MEMORY_TAG(Text);
+
+		std::ifstream file(path, std::ios::in | std::ios::binary);
+		if (!file.is_open())
+		{
+			PS_CORE_ERROR("Failed to open font {0}", path);
+			return nullptr;
+		}
+
+		std::shared_ptr<Font> font(new Font());
+		font->m_ID = s_NextFontID++;
+		font->m_Path = path;
+		font->m_Data = std::make_shared<const std::vector<uint8_t>>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		font->m_ContentHash = HashBytes(*font->m_Data);
+
+		uint32_t glyphCount = 0;
+		if (FT_Face face = GetThreadFace(font->m_ID, font->m_Data, 0))
+		{
+			glyphCount = (uint32_t)face->num_glyphs;
+		}
+		else
+		{
+			const uint8_t* data = font->m_Data->data();
+			int offset = stbtt_GetFontOffsetForIndex(data, 0);
+			font->m_StbInfo = std::make_unique<stbtt_fontinfo>();
+			if (offset < 0 || !stbtt_InitFont(font->m_StbInfo.get(), data, offset))
+			{
+				PS_CORE_ERROR("Failed to load font {0}", path);
+				return nullptr;
+			}
+			font->m_Backend = FontBackend::StbTrueType;
+			glyphCount = (uint32_t)font->m_StbInfo->numGlyphs;
+		}
+
+		for (uint32_t codepoint = 0; codepoint < font->m_AsciiGlyphs.size(); codepoint++)
+			font->m_AsciiGlyphs[codepoint] = font->LookupGlyphIndex(codepoint);
+
+		PS_CORE_INFO("Loaded font {0} ({1} glyphs, {2})", path, glyphCount,
+			font->m_Backend == FontBackend::FreeType ? "FreeType" : "stb_truetype");
+		return font;
+	}
+
+	uint32_t Font::LookupGlyphIndex(uint32_t codepoint) const
+	{
+		if (m_Backend == FontBackend::StbTrueType)
+			return (uint32_t)stbtt_FindGlyphIndex(m_StbInfo.get(), (int)codepoint);
+
+		FT_Face face = GetThreadFace(m_ID, m_Data, 0);
+		return face ? FT_Get_Char_Index(face, codepoint) : 0;
+	}
+
+	FontMetrics Font::GetMetrics(uint32_t pixelSize) const
+	{
+		FontMetrics metrics;
+		if (m_Backend == FontBackend::StbTrueType)
+		{
+			int ascent, descent, lineGap;
+			stbtt_GetFontVMetrics(m_StbInfo.get(), &ascent, &descent, &lineGap);
+			float scale = stbtt_ScaleForMappingEmToPixels(m_StbInfo.get(), (float)pixelSize);
+			metrics.Ascender = std::ceil(ascent * scale);
+			metrics.Descender = std::floor(descent * scale);
+			metrics.LineHeight = std::ceil((ascent - descent + lineGap) * scale);
+			return metrics;
+		}
+
+		FT_Face face = GetThreadFace(m_ID, m_Data, pixelSize);
+		if (!face)
+			return metrics;
+
+		// 26.6 fixed point
+		const FT_Size_Metrics& size = face->size->metrics;
+		metrics.Ascender = size.ascender / 64.0f;
+		metrics.Descender = size.descender / 64.0f;
+		metrics.LineHeight = size.height / 64.0f;
+		return metrics;
+	}
+
+	float Font::GetKerning(uint32_t leftGlyph, uint32_t rightGlyph, uint32_t pixelSize) const
+	{
+		if (m_Backend == FontBackend::StbTrueType)
+		{
+			const stbtt_fontinfo* info = m_StbInfo.get();
+			float scale = stbtt_ScaleForMappingEmToPixels(info, (float)pixelSize);
+			return stbtt_GetGlyphKernAdvance(info, (int)leftGlyph, (int)rightGlyph) * scale;
+		}
+
+		FT_Face face = GetThreadFace(m_ID, m_Data, pixelSize);
+		if (!face || !FT_HAS_KERNING(face))
+			return 0.0f;
+
+		FT_Vector delta;
+		if (FT_Get_Kerning(face, leftGlyph, rightGlyph, FT_KERNING_UNFITTED, &delta) != 0)
+			return 0.0f;
+		return delta.x / 64.0f;
+	}
+
+	float Font::GetAdvance(uint32_t glyphIndex, uint32_t pixelSize, GlyphRenderMode mode) const
+	{
+		bool distanceField = mode == GlyphRenderMode::DistanceField;
+		if (distanceField)
+			pixelSize = DistanceFieldSize;
+
+		if (m_Backend == FontBackend::StbTrueType)
+		{
+			const stbtt_fontinfo* info = m_StbInfo.get();
+			float scale = stbtt_ScaleForMappingEmToPixels(info, (float)pixelSize);
+
+			int advance, leftBearing;
+			stbtt_GetGlyphHMetrics(info, (int)glyphIndex, &advance, &leftBearing);
+			return distanceField ? advance * scale : std::round(advance * scale);
+		}
+
+		// Same load flags as the rasterizers, hinting changes the advance
+		FT_Face face = GetThreadFace(m_ID, m_Data, pixelSize);
+		if (!face || FT_Load_Glyph(face, glyphIndex, distanceField ? FT_LOAD_NO_HINTING : FT_LOAD_TARGET_LIGHT) != 0)
+			return 0.0f;
+		return face->glyph->advance.x / 64.0f;
+	}
+
+	bool Font::RasterizeGlyph(uint32_t glyphIndex, uint32_t pixelSize, GlyphBitmap& bitmap) const
+	{
+		PS_MEMORY_TAG(Text);
+
+		if (m_Backend == FontBackend::StbTrueType)
+		{
+			const stbtt_fontinfo* info = m_StbInfo.get();
+			float scale = stbtt_ScaleForMappingEmToPixels(info, (float)pixelSize);
+
+			int x0, y0, x1, y1, advance, leftBearing;
+			stbtt_GetGlyphBitmapBox(info, (int)glyphIndex, scale, scale, &x0, &y0, &x1, &y1);
+			stbtt_GetGlyphHMetrics(info, (int)glyphIndex, &advance, &leftBearing);
+
+			bitmap.Width = (uint32_t)std::max(x1 - x0, 0);
+			bitmap.Height = (uint32_t)std::max(y1 - y0, 0);
+			bitmap.BearingX = x0;
+			bitmap.BearingY = -y0;
+			bitmap.Advance = std::round(advance * scale);
+			bitmap.Pixels.resize((size_t)bitmap.Width * bitmap.Height);
+			if (!bitmap.Pixels.empty())
+				stbtt_MakeGlyphBitmap(info, bitmap.Pixels.data(), (int)bitmap.Width, (int)bitmap.Height, (int)bitmap.Width, scale, scale, (int)glyphIndex);
+			return true;
+		}
+
+		FT_Face face = GetThreadFace(m_ID, m_Data, pixelSize);
+		if (!face || FT_Load_Glyph(face, glyphIndex, FT_LOAD_RENDER | FT_LOAD_TARGET_LIGHT) != 0)
+			return false;
+
+		CopyBitmap(face->glyph, bitmap);
+		return true;
+	}
+
+	bool Font::GenerateDistanceField(uint32_t glyphIndex, GlyphBitmap& bitmap) const
+	{
+		PS_MEMORY_TAG(Text);
+
+		if (m_Backend == FontBackend::StbTrueType)
+		{
+			const stbtt_fontinfo* info = m_StbInfo.get();
+			float scale = stbtt_ScaleForMappingEmToPixels(info, (float)DistanceFieldSize);
+
+			int width = 0, height = 0, offsetX = 0, offsetY = 0, advance, leftBearing;
+			uint8_t* pixels = stbtt_GetGlyphSDF(info, scale, (int)glyphIndex, (int)DistanceFieldSpread, 128,
+				128.0f / DistanceFieldSpread, &width, &height, &offsetX, &offsetY);
+			stbtt_GetGlyphHMetrics(info, (int)glyphIndex, &advance, &leftBearing);
+
+			// Blank glyphs come back without a bitmap
+			bitmap.Width = pixels ? (uint32_t)width : 0;
+			bitmap.Height = pixels ? (uint32_t)height : 0;
+			bitmap.BearingX = offsetX;
+			bitmap.BearingY = -offsetY;
+			bitmap.Advance = advance * scale;
+			bitmap.Pixels.assign(pixels, pixels + (size_t)bitmap.Width * bitmap.Height);
+			stbtt_FreeSDF(pixels, nullptr);
+			return true;
+		}
+
+		// Unhinted outlines, the field is scaled to every size anyway
+		FT_Face face = GetThreadFace(m_ID, m_Data, DistanceFieldSize);
+		if (!face || FT_Load_Glyph(face, glyphIndex, FT_LOAD_NO_HINTING) != 0)
+			return false;
+
+		// Blank glyphs have nothing to render
+		if (face->glyph->format == FT_GLYPH_FORMAT_OUTLINE && face->glyph->outline.n_points == 0)
+		{
+			bitmap = GlyphBitmap();
+			bitmap.Advance = face->glyph->advance.x / 64.0f;
+			return true;
+		}
+
+		if (FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF) != 0)
+			return false;
+
+		CopyBitmap(face->glyph, bitmap);
+		return true;
+	}
+
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "pspch.h"
+
+struct stbtt_fontinfo;
+
+namespace PulseStudio {
+
+	enum class FontBackend : uint32_t
+	{
+		FreeType = 0,
+		StbTrueType		// Fallback for files FreeType cannot open
+	};
+
+	enum class GlyphRenderMode : uint32_t
+	{
+		Bitmap = 0,		// Coverage rasterized at every pixel size, hinted and crisp
+		DistanceField	// Signed distance field generated once at DistanceFieldSize, scaled in the shader
+	};
+
+	struct FontMetrics
+	{
+		float Ascender = 0.0f;		// Baseline to the top of the tallest glyph, pixels
+		float Descender = 0.0f;		// Baseline to the bottom, negative
+		float LineHeight = 0.0f;
+	};
+
+	// Coverage bitmap of one glyph, rows are tightly packed. For distance fields 128 is the
+	// outline and values grow towards the inside, DistanceFieldSpread pixels map to 127.
+	struct GlyphBitmap
+	{
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		int32_t BearingX = 0;		// Pen position to the left edge
+		int32_t BearingY = 0;		// Baseline to the top edge, up is positive
+		float Advance = 0.0f;
+		std::vector<uint8_t> Pixels;
+	};
+
+	/*
+	* A font file loaded into memory once and rasterized at any pixel size. FreeType faces are not
+	* thread-safe, so every thread rasterizes through its own FT_Library and faces, created on first
+	* use and released when the thread exits (or, for the calling thread, with the Font). Files
+	* FreeType cannot open fall back to stb_truetype, which is read-only after loading.
+	* All methods can be called from any thread, except SetRenderMode, which belongs to the thread
+	* drawing with the font.
+	*/
+	class Font : public std::enable_shared_from_this<Font>
+	{
+	public:
+		// Base pixel size and spread of distance field glyphs, every other size scales from it
+		static constexpr uint32_t DistanceFieldSize = 32;
+		static constexpr uint32_t DistanceFieldSpread = 4;
+
+		~Font();
+
+		Font(const Font&) = delete;
+		Font& operator=(const Font&) = delete;
+
+		// nullptr (and an error in the log) when the file cannot be read or parsed
+		static std::shared_ptr<Font> Load(const std::string& path);
+
+		inline uint32_t GetID() const { return m_ID; }
+		inline const std::string& GetPath() const { return m_Path; }
+		inline FontBackend GetBackend() const { return m_Backend; }
+		// FNV-1a of the file contents, identifies the font across sessions
+		inline uint64_t GetContentHash() const { return m_ContentHash; }
+
+		// Distance fields trade hinting for zooming without rasterizing again
+		inline GlyphRenderMode GetRenderMode() const { return m_RenderMode; }
+		inline void SetRenderMode(GlyphRenderMode mode) { m_RenderMode = mode; }
+
+		// 0 when the font has no glyph for the code point
+		inline uint32_t GetGlyphIndex(uint32_t codepoint) const
+		{
+			return codepoint < m_AsciiGlyphs.size() ? m_AsciiGlyphs[codepoint] : LookupGlyphIndex(codepoint);
+		}
+
+		FontMetrics GetMetrics(uint32_t pixelSize) const;
+		// Pen adjustment between two glyphs in pixels, from the 'kern' table (and GPOS pairs with
+		// stb_truetype). Unhinted, callers snap.
+		float GetKerning(uint32_t leftGlyph, uint32_t rightGlyph, uint32_t pixelSize) const;
+
+		// Pen advance in pixels without rendering the glyph, the Advance RasterizeGlyph (or, for
+		// DistanceField, GenerateDistanceField at DistanceFieldSize) would report
+		float GetAdvance(uint32_t glyphIndex, uint32_t pixelSize, GlyphRenderMode mode) const;
+
+		bool RasterizeGlyph(uint32_t glyphIndex, uint32_t pixelSize, GlyphBitmap& bitmap) const;
+		// Distance field of the glyph at DistanceFieldSize, padded by DistanceFieldSpread
+		bool GenerateDistanceField(uint32_t glyphIndex, GlyphBitmap& bitmap) const;
+	private:
+		Font() = default;
+
+		uint32_t LookupGlyphIndex(uint32_t codepoint) const;
+
+		uint32_t m_ID = 0;
+		std::string m_Path;
+		FontBackend m_Backend = FontBackend::FreeType;
+		GlyphRenderMode m_RenderMode = GlyphRenderMode::Bitmap;
+		uint64_t m_ContentHash = 0;
+
+		// Shared with the per-thread faces, which may outlive the Font on worker threads
+		std::shared_ptr<const std::vector<uint8_t>> m_Data;
+		std::unique_ptr<stbtt_fontinfo> m_StbInfo;
+
+		// Glyph indices of the ASCII range, looked up once at load
+		std::array<uint32_t, 128> m_AsciiGlyphs = {};
+	};
+
+}
@@ -0,0 +1,357 @@
+#include "pspch.h"
+#include "GlyphAtlas.h"
+
+#include "GlyphCache.h"
+#include "PulseStudio/Renderer/Renderer2D.h"
+#include "PulseStudio/Profiler.h"
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#include <stb_rect_pack.h>
+
+namespace PulseStudio {
+
+	// Empty border right and below every glyph so linear filtering never picks up a neighbour
+	static constexpr uint32_t s_Padding = 1;
+
+	// Glyphs per job when a batch is rasterized in parallel
+	static constexpr uint32_t s_RasterizeBatchSize = 16;
+
+	GlyphAtlas::GlyphAtlas(uint32_t pageSize, uint32_t maxPages)
+		: m_PageSize(pageSize), m_MaxPages(std::max(maxPages, 1u))
+	{
+	}
+
+	GlyphAtlas::~GlyphAtlas()
+	{
+		// Batches still in flight own their data, they finish on their own
+
+		if (!Renderer2D::IsInitialized())
+			return;
+
+		for (Page& page : m_Pages)
+			Renderer2D::DestroyTexture(page.Texture);
+	}
+
+	void GlyphAtlas::BeginFrame()
+	{
+		m_FrameStats.Pages = (uint32_t)m_Pages.size();
+		m_FrameStats.Glyphs = (uint32_t)m_Glyphs.size();
+		m_LastFrameStats = m_FrameStats;
+		m_FrameStats = {};
+		m_Frame++;
+
+		Profiler::RecordCounter("Glyph atlas hits", m_LastFrameStats.Hits);
+		Profiler::RecordCounter("Glyph atlas misses", m_LastFrameStats.Misses);
+
+		std::erase_if(m_Batches, [this](const std::shared_ptr<Batch>& batch)
+			{
+				if (!batch->Job.IsDone())
+					return false;
+				Integrate(*batch);
+				return true;
+			});
+		Upload();
+	}
+
+	const AtlasGlyph* GlyphAtlas::GetGlyph(Font& font, uint32_t glyphIndex, uint32_t pixelSize)
+	{
+		GlyphRenderMode mode = font.GetRenderMode();
+		pixelSize = GetAtlasSize(mode, pixelSize);
+		uint64_t key = MakeKey(font.GetID(), glyphIndex, pixelSize, mode);
+		auto it = m_Glyphs.find(key);
+		if (it != m_Glyphs.end())
+		{
+			m_FrameStats.Hits++;
+			if (it->second.Region.TextureID != 0)
+				m_Pages[it->second.Page].LastUsedFrame = m_Frame;
+			return &it->second;
+		}
+
+		PS_PROFILE_FUNCTION();
+		PS_MEMORY_TAG(Text);
+
+		// Already on its way, waiting helps the workers finish the batch
+		auto pending = m_PendingGlyphs.find(key);
+		if (pending != m_PendingGlyphs.end())
+		{
+			Batch* batch = pending->second;
+			batch->Job.Wait();
+			Integrate(*batch);
+			std::erase_if(m_Batches, [batch](const std::shared_ptr<Batch>& entry) { return entry.get() == batch; });
+
+			m_FrameStats.Hits++;
+			it = m_Glyphs.find(key);
+			return it != m_Glyphs.end() ? &it->second : nullptr;
+		}
+
+		m_FrameStats.Misses++;
+
+		GlyphBitmap bitmap;
+		bool rasterized = mode == GlyphRenderMode::DistanceField ? font.GenerateDistanceField(glyphIndex, bitmap)
+			: font.RasterizeGlyph(glyphIndex, pixelSize, bitmap);
+		if (!rasterized)
+			return nullptr;
+		return Insert(key, bitmap, mode);
+	}
+
+	void GlyphAtlas::Prefetch(const std::shared_ptr<Font>& font, uint32_t pixelSize, std::span<const uint32_t> glyphIndices)
+	{
+		PS_MEMORY_TAG(Text);
+
+		auto batch = std::make_shared<Batch>();
+		batch->Font = font;
+		batch->Mode = font->GetRenderMode();
+		batch->PixelSize = GetAtlasSize(batch->Mode, pixelSize);
+		for (uint32_t glyphIndex : glyphIndices)
+		{
+			uint64_t key = MakeKey(font->GetID(), glyphIndex, batch->PixelSize, batch->Mode);
+			if (!m_Glyphs.contains(key) && !m_PendingGlyphs.contains(key))
+				batch->GlyphIndices.push_back(glyphIndex);
+		}
+
+		if (!batch->GlyphIndices.empty())
+			Schedule(std::move(batch));
+	}
+
+	void GlyphAtlas::Preload(const std::shared_ptr<Font>& font, uint32_t pixelSize)
+	{
+		PS_MEMORY_TAG(Text);
+
+		// The cache file always holds the whole range, whatever is already in the atlas
+		auto batch = std::make_shared<Batch>();
+		batch->Font = font;
+		batch->Mode = font->GetRenderMode();
+		batch->PixelSize = GetAtlasSize(batch->Mode, pixelSize);
+		batch->UseDiskCache = true;
+		for (uint32_t codepoint = 0x20; codepoint <= 0xFF; codepoint++)
+		{
+			if (codepoint < 0x7F || codepoint >= 0xA0)
+				batch->GlyphIndices.push_back(font->GetGlyphIndex(codepoint));
+		}
+
+		std::sort(batch->GlyphIndices.begin(), batch->GlyphIndices.end());
+		batch->GlyphIndices.erase(std::unique(batch->GlyphIndices.begin(), batch->GlyphIndices.end()), batch->GlyphIndices.end());
+		Schedule(std::move(batch));
+	}
+
+	void GlyphAtlas::Upload()
+	{
+		for (Page& page : m_Pages)
+		{
+			if (page.DirtyMinX >= page.DirtyMaxX)
+				continue;
+
+			const uint8_t* pixels = &page.Pixels[(size_t)page.DirtyMinY * m_PageSize + page.DirtyMinX];
+			Renderer2D::UpdateTexture(page.Texture, page.DirtyMinX, page.DirtyMinY,
+				page.DirtyMaxX - page.DirtyMinX, page.DirtyMaxY - page.DirtyMinY, pixels, m_PageSize);
+			page.DirtyMinX = page.DirtyMinY = page.DirtyMaxX = page.DirtyMaxY = 0;
+		}
+	}
+
+	void GlyphAtlas::RunBatch(const std::shared_ptr<Batch>& batch)
+	{
+		PS_PROFILE_FUNCTION();
+		PS_MEMORY_TAG(Text);
+
+		const Font& font = *batch->Font;
+		if (batch->UseDiskCache && GlyphCache::Load(font, batch->PixelSize, batch->Mode, batch->GlyphIndices, batch->Bitmaps))
+		{
+			batch->Valid.assign(batch->GlyphIndices.size(), 1);
+			return;
+		}
+
+		// Every worker rasterizes through its own FreeType library, see Font
+		uint32_t count = (uint32_t)batch->GlyphIndices.size();
+		batch->Bitmaps.resize(count);
+		batch->Valid.assign(count, 0);
+		Batch* target = batch.get();
+		JobSystem::ParallelFor(count, s_RasterizeBatchSize, [target](uint32_t begin, uint32_t end)
+			{
+				PS_MEMORY_TAG(Text);
+				const Font& font = *target->Font;
+				for (uint32_t i = begin; i < end; i++)
+				{
+					bool rasterized = target->Mode == GlyphRenderMode::DistanceField
+						? font.GenerateDistanceField(target->GlyphIndices[i], target->Bitmaps[i])
+						: font.RasterizeGlyph(target->GlyphIndices[i], target->PixelSize, target->Bitmaps[i]);
+					target->Valid[i] = rasterized ? 1 : 0;
+				}
+			}).Wait();
+
+		if (!batch->UseDiskCache)
+			return;
+
+		// Writing the file does not hold up the atlas
+		JobSystem::Schedule([batch]()
+			{
+				PS_PROFILE_SCOPE("GlyphCache::Save");
+				PS_MEMORY_TAG(Text);
+
+				std::vector<uint32_t> glyphIndices;
+				std::vector<GlyphBitmap> bitmaps;
+				for (size_t i = 0; i < batch->GlyphIndices.size(); i++)
+				{
+					if (!batch->Valid[i])
+						continue;
+					glyphIndices.push_back(batch->GlyphIndices[i]);
+					bitmaps.push_back(batch->Bitmaps[i]);
+				}
+
+				if (!GlyphCache::Save(*batch->Font, batch->PixelSize, batch->Mode, glyphIndices, bitmaps))
+					PS_CORE_WARN("Failed to save glyph cache for {0} at {1}px", batch->Font->GetPath(), batch->PixelSize);
+			});
+	}
+
+	void GlyphAtlas::Schedule(std::shared_ptr<Batch> batch)
+	{
+		for (uint32_t glyphIndex : batch->GlyphIndices)
+			m_PendingGlyphs.try_emplace(MakeKey(batch->Font->GetID(), glyphIndex, batch->PixelSize, batch->Mode), batch.get());
+
+		batch->Job = JobSystem::Schedule([batch]() { RunBatch(batch); });
+		m_Batches.push_back(std::move(batch));
+	}
+
+	void GlyphAtlas::Integrate(Batch& batch)
+	{
+		PS_PROFILE_FUNCTION();
+
+		uint32_t fontID = batch.Font->GetID();
+		for (size_t i = 0; i < batch.GlyphIndices.size(); i++)
+		{
+			uint64_t key = MakeKey(fontID, batch.GlyphIndices[i], batch.PixelSize, batch.Mode);
+			if (batch.Valid[i] && !m_Glyphs.contains(key) && Insert(key, batch.Bitmaps[i], batch.Mode))
+				m_FrameStats.Prefetched++;
+		}
+
+		std::erase_if(m_PendingGlyphs, [&batch](const auto& entry) { return entry.second == &batch; });
+	}
+
+	const AtlasGlyph* GlyphAtlas::Insert(uint64_t key, const GlyphBitmap& bitmap, GlyphRenderMode mode)
+	{
+		PS_MEMORY_TAG(Text);
+
+		AtlasGlyph glyph;
+		glyph.DistanceField = mode == GlyphRenderMode::DistanceField;
+		glyph.Size = { (float)bitmap.Width, (float)bitmap.Height };
+		glyph.Offset = { (float)bitmap.BearingX, -(float)bitmap.BearingY };
+		glyph.Advance = bitmap.Advance;
+
+		// Blank glyphs (space) only carry an advance
+		if (bitmap.Width > 0 && bitmap.Height > 0)
+		{
+			uint32_t width = bitmap.Width + s_Padding;
+			uint32_t height = bitmap.Height + s_Padding;
+			uint32_t page, x, y;
+			if (!Place(width, height, page, x, y))
+			{
+				if (!m_WarnedFull)
+					PS_CORE_WARN("Glyph atlas is full ({0} pages in use this frame), glyphs are skipped", m_Pages.size());
+				m_WarnedFull = true;
+				return nullptr;
+			}
+
+			Page& target = m_Pages[page];
+			for (uint32_t row = 0; row < bitmap.Height; row++)
+				std::memcpy(&target.Pixels[(size_t)(y + row) * m_PageSize + x], &bitmap.Pixels[(size_t)row * bitmap.Width], bitmap.Width);
+
+			// Padding included, it may still hold pixels of an evicted glyph on the GPU
+			if (target.DirtyMinX >= target.DirtyMaxX)
+			{
+				target.DirtyMinX = x;
+				target.DirtyMinY = y;
+				target.DirtyMaxX = x + width;
+				target.DirtyMaxY = y + height;
+			}
+			else
+			{
+				target.DirtyMinX = std::min(target.DirtyMinX, x);
+				target.DirtyMinY = std::min(target.DirtyMinY, y);
+				target.DirtyMaxX = std::max(target.DirtyMaxX, x + width);
+				target.DirtyMaxY = std::max(target.DirtyMaxY, y + height);
+			}
+
+			float scale = 1.0f / m_PageSize;
+			glyph.Page = page;
+			glyph.Region.TextureID = target.Texture;
+			glyph.Region.Min = glm::vec2((float)x, (float)y) * scale;
+			glyph.Region.Max = glm::vec2((float)(x + bitmap.Width), (float)(y + bitmap.Height)) * scale;
+			target.LastUsedFrame = m_Frame;
+		}
+
+		return &m_Glyphs.emplace(key, glyph).first->second;
+	}
+
+	bool GlyphAtlas::Place(uint32_t width, uint32_t height, uint32_t& page, uint32_t& x, uint32_t& y)
+	{
+		if (width > m_PageSize || height > m_PageSize)
+			return false;
+
+		// Newest pages first, older ones are usually full
+		for (uint32_t i = (uint32_t)m_Pages.size(); i > 0; i--)
+		{
+			if (PackInto(i - 1, width, height, x, y))
+			{
+				page = i - 1;
+				return true;
+			}
+		}
+
+		if (m_Pages.size() < m_MaxPages)
+		{
+			AddPage();
+			page = (uint32_t)m_Pages.size() - 1;
+			return PackInto(page, width, height, x, y);
+		}
+
+		// Recycle the least recently used page, unless everything is in use this frame
+		uint32_t oldest = 0;
+		for (uint32_t i = 1; i < m_Pages.size(); i++)
+		{
+			if (m_Pages[i].LastUsedFrame < m_Pages[oldest].LastUsedFrame)
+				oldest = i;
+		}
+		if (m_Pages[oldest].LastUsedFrame >= m_Frame)
+			return false;
+
+		ResetPage(oldest);
+		m_FrameStats.Evictions++;
+		page = oldest;
+		return PackInto(page, width, height, x, y);
+	}
+
+	bool GlyphAtlas::PackInto(uint32_t page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y)
+	{
+		stbrp_rect rect = {};
+		rect.w = (stbrp_coord)width;
+		rect.h = (stbrp_coord)height;
+		if (!stbrp_pack_rects(m_Pages[page].Packer.get(), &rect, 1) || !rect.was_packed)
+			return false;
+
+		x = (uint32_t)rect.x;
+		y = (uint32_t)rect.y;
+		return true;
+	}
+
+	void GlyphAtlas::AddPage()
+	{
+		Page page;
+		page.Texture = Renderer2D::CreateTexture(m_PageSize, m_PageSize, TextureFormat::R8);
+		page.Packer = std::make_unique<stbrp_context>();
+		page.Nodes = std::make_unique<stbrp_node[]>(m_PageSize);
+		page.Pixels.resize((size_t)m_PageSize * m_PageSize);
+		m_Pages.push_back(std::move(page));
+		ResetPage((uint32_t)m_Pages.size() - 1);
+	}
+
+	void GlyphAtlas::ResetPage(uint32_t page)
+	{
+		Page& target = m_Pages[page];
+		stbrp_init_target(target.Packer.get(), (int)m_PageSize, (int)m_PageSize, target.Nodes.get(), (int)m_PageSize);
+
+		// The GPU copy keeps the old pixels until new glyphs are uploaded over them
+		std::fill(target.Pixels.begin(), target.Pixels.end(), (uint8_t)0);
+
+		std::erase_if(m_Glyphs, [page](const auto& entry) { return entry.second.Page == page && entry.second.Region.TextureID != 0; });
+	}
+
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "Font.h"
+#include "PulseStudio/Jobs/JobSystem.h"
+#include "PulseStudio/Renderer/Batch2D.h"
+
+#include <span>
+
+struct stbrp_context;
+struct stbrp_node;
+
+namespace PulseStudio {
+
+	// Placement of a cached glyph, pixels relative to the pen position on the baseline
+	struct AtlasGlyph
+	{
+		TextureRegion Region;
+		glm::vec2 Size = { 0.0f, 0.0f };
+		glm::vec2 Offset = { 0.0f, 0.0f };	// Pen position to the top left corner, y down
+		float Advance = 0.0f;
+		uint32_t Page = 0;
+		bool DistanceField = false;			// Metrics at Font::DistanceFieldSize, draw scaled
+	};
+
+	struct GlyphAtlasStats
+	{
+		uint32_t Hits = 0;
+		uint32_t Misses = 0;		// Glyphs rasterized on the main thread
+		uint32_t Prefetched = 0;	// Glyphs added from background batches and the disk cache
+		uint32_t Evictions = 0;		// Pages recycled
+		uint32_t Pages = 0;
+		uint32_t Glyphs = 0;
+	};
+
+	/*
+	* Rasterize-once cache of glyph bitmaps in single-channel texture pages, keyed by font, pixel
+	* size and glyph index. New glyphs are packed into the current pages with stb_rect_pack; when
+	* they are all full another page is added, up to maxPages. After that the least recently used
+	* page that nothing drew this frame is cleared and repacked, which evicts its glyphs together
+	* (rect packers cannot free single rects, and glyphs used together tend to age together).
+	*
+	* Every page keeps a CPU copy. Glyphs are written there and Upload() sends one sub-image per
+	* page covering everything that changed, so a batch of new glyphs costs one upload per page
+	* rather than one per glyph.
+	*
+	* Prefetch() and Preload() rasterize on the job system, with the results placed in the pages by
+	* BeginFrame() once the batch is done. GetGlyph() on a glyph that is still in flight waits for
+	* its batch instead of rasterizing it twice.
+	* Fonts in GlyphRenderMode::DistanceField share one entry per glyph for every pixel size, so
+	* zooming adds nothing to the atlas.
+	* Main thread only. Textures are Renderer2D textures, so glyphs draw straight into the batch.
+	*/
+	class GlyphAtlas
+	{
+	public:
+		GlyphAtlas(uint32_t pageSize = 1024, uint32_t maxPages = 8);
+		~GlyphAtlas();
+
+		GlyphAtlas(const GlyphAtlas&) = delete;
+		GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+		// Advances the LRU clock, rolls the per-frame counters and adds finished batches
+		void BeginFrame();
+
+		// Cached glyph, rasterized on a miss. nullptr if the glyph cannot be rasterized or placed.
+		// Call Upload() before the frame ends to get new glyphs onto the GPU. Distance field glyphs
+		// ignore pixelSize, see AtlasGlyph::DistanceField.
+		const AtlasGlyph* GetGlyph(Font& font, uint32_t glyphIndex, uint32_t pixelSize);
+
+		// Rasterize glyphs on worker threads, they become available from a later BeginFrame()
+		void Prefetch(const std::shared_ptr<Font>& font, uint32_t pixelSize, std::span<const uint32_t> glyphIndices);
+
+		// Prefetch the ASCII and Latin-1 glyphs from the disk cache, rasterizing and writing the
+		// cache file when there is none yet
+		void Preload(const std::shared_ptr<Font>& font, uint32_t pixelSize);
+
+		// Submit the changed part of every page to the render thread
+		void Upload();
+
+		inline const GlyphAtlasStats& GetFrameStats() const { return m_FrameStats; }
+		inline const GlyphAtlasStats& GetLastFrameStats() const { return m_LastFrameStats; }
+		inline uint32_t GetPageSize() const { return m_PageSize; }
+	private:
+		struct Page
+		{
+			uint32_t Texture = 0;
+			std::unique_ptr<stbrp_context> Packer;
+			std::unique_ptr<stbrp_node[]> Nodes;
+			std::vector<uint8_t> Pixels;
+			uint64_t LastUsedFrame = 0;
+
+			// Changed since the last upload, empty when MinX >= MaxX
+			uint32_t DirtyMinX = 0, DirtyMinY = 0, DirtyMaxX = 0, DirtyMaxY = 0;
+		};
+
+		// Glyphs rasterized (or loaded) off the main thread, shared with the jobs filling it
+		struct Batch
+		{
+			std::shared_ptr<PulseStudio::Font> Font;
+			uint32_t PixelSize = 0;
+			GlyphRenderMode Mode = GlyphRenderMode::Bitmap;
+			bool UseDiskCache = false;
+			std::vector<uint32_t> GlyphIndices;
+			std::vector<GlyphBitmap> Bitmaps;
+			std::vector<uint8_t> Valid;
+			JobHandle Job;
+		};
+
+		static inline uint64_t MakeKey(uint32_t fontID, uint32_t glyphIndex, uint32_t pixelSize, GlyphRenderMode mode)
+		{
+			return ((uint64_t)(fontID & 0x7FFFF) << 45) | ((uint64_t)mode << 44) | ((uint64_t)(pixelSize & 0xFFF) << 32) | glyphIndex;
+		}
+
+		// Distance fields exist at a single size
+		static inline uint32_t GetAtlasSize(GlyphRenderMode mode, uint32_t pixelSize)
+		{
+			return mode == GlyphRenderMode::DistanceField ? Font::DistanceFieldSize : pixelSize;
+		}
+
+		static void RunBatch(const std::shared_ptr<Batch>& batch);
+		void Schedule(std::shared_ptr<Batch> batch);
+		void Integrate(Batch& batch);
+
+		const AtlasGlyph* Insert(uint64_t key, const GlyphBitmap& bitmap, GlyphRenderMode mode);
+		bool Place(uint32_t width, uint32_t height, uint32_t& page, uint32_t& x, uint32_t& y);
+		bool PackInto(uint32_t page, uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+		void AddPage();
+		void ResetPage(uint32_t page);
+
+		uint32_t m_PageSize;
+		uint32_t m_MaxPages;
+		std::vector<Page> m_Pages;
+		std::unordered_map<uint64_t, AtlasGlyph> m_Glyphs;
+		uint64_t m_Frame = 1;
+
+		std::vector<std::shared_ptr<Batch>> m_Batches;
+		std::unordered_map<uint64_t, Batch*> m_PendingGlyphs;
+
+		GlyphAtlasStats m_FrameStats;
+		GlyphAtlasStats m_LastFrameStats;
+		bool m_WarnedFull = false;
+	};
+
+}
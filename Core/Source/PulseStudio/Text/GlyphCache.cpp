@@ -0,0 +1,261 @@
+#include "pspch.h"
+#include "GlyphCache.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace PulseStudio {
+
+	static constexpr char s_Magic[8] = { 'P', 'S', 'G', 'L', 'Y', 'P', 'H', '\n' };
+	static constexpr uint32_t s_Version = 2;
+
+	struct GlyphCacheHeader
+	{
+		char Magic[8];
+		uint32_t Version;
+		uint32_t Backend;
+		uint64_t FontHash;
+		uint32_t PixelSize;
+		uint32_t GlyphCount;
+		uint32_t Mode;
+		uint32_t Reserved;
+	};
+
+	struct GlyphCacheRecord
+	{
+		uint32_t GlyphIndex;
+		uint16_t Width;
+		uint16_t Height;
+		int16_t BearingX;
+		int16_t BearingY;
+		float Advance;
+		uint32_t PixelOffset;
+	};
+
+	static_assert(sizeof(GlyphCacheHeader) == 40 && sizeof(GlyphCacheRecord) == 20, "Glyph cache layout changed, bump s_Version");
+
+	static uint64_t GetProcessID()
+	{
+#ifdef _WIN32
+		return (uint64_t)GetCurrentProcessId();
+#else
+		return (uint64_t)getpid();
+#endif
+	}
+
+	// Read-only view of a whole file, unmapped on destruction
+	class MappedFile
+	{
+	public:
+		~MappedFile()
+		{
+#ifdef _WIN32
+			if (m_Data)
+				UnmapViewOfFile(m_Data);
+			if (m_Mapping)
+				CloseHandle(m_Mapping);
+			if (m_File != INVALID_HANDLE_VALUE)
+				CloseHandle(m_File);
+#else
+			if (m_Data)
+				::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+		}
+
+		bool Open(const std::filesystem::path& path)
+		{
+#ifdef _WIN32
+			m_File = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			LARGE_INTEGER size;
+			if (m_File == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_File, &size) || size.QuadPart == 0)
+				return false;
+
+			m_Mapping = CreateFileMappingW(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			m_Data = m_Mapping ? static_cast<const uint8_t*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+			m_Size = (size_t)size.QuadPart;
+#else
+			int fd = ::open(path.c_str(), O_RDONLY);
+			if (fd < 0)
+				return false;
+
+			struct stat info;
+			if (::fstat(fd, &info) == 0 && info.st_size > 0)
+			{
+				void* view = ::mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (view != MAP_FAILED)
+				{
+					m_Data = static_cast<const uint8_t*>(view);
+					m_Size = (size_t)info.st_size;
+				}
+			}
+			// The mapping keeps the file alive
+			::close(fd);
+#endif
+			return m_Data != nullptr;
+		}
+
+		inline const uint8_t* GetData() const { return m_Data; }
+		inline size_t GetSize() const { return m_Size; }
+	private:
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+#ifdef _WIN32
+		HANDLE m_File = INVALID_HANDLE_VALUE;
+		HANDLE m_Mapping = nullptr;
+#endif
+	};
+
+	std::filesystem::path GlyphCache::GetDirectory()
+	{
+		namespace fs = std::filesystem;
+
+#ifdef _WIN32
+		if (const char* localAppData = std::getenv("LOCALAPPDATA"))
+			return fs::path(localAppData) / "PulseStudio" / "GlyphCache";
+#else
+		if (const char* cacheHome = std::getenv("XDG_CACHE_HOME"); cacheHome && *cacheHome)
+			return fs::path(cacheHome) / "PulseStudio" / "GlyphCache";
+		if (const char* home = std::getenv("HOME"); home && *home)
+			return fs::path(home) / ".cache" / "PulseStudio" / "GlyphCache";
+#endif
+		return {};
+	}
+
+	std::filesystem::path GlyphCache::GetPath(const Font& font, uint32_t pixelSize, GlyphRenderMode mode)
+	{
+		std::filesystem::path directory = GetDirectory();
+		if (directory.empty())
+			return {};
+
+		std::stringstream name;
+		name << std::hex << std::setw(16) << std::setfill('0') << font.GetContentHash() << std::dec
+			<< "-" << pixelSize << (mode == GlyphRenderMode::DistanceField ? "-sdf-" : "-") << (uint32_t)font.GetBackend() << ".glyphs";
+		return directory / name.str();
+	}
+
+	bool GlyphCache::Load(const Font& font, uint32_t pixelSize, GlyphRenderMode mode,
+		std::vector<uint32_t>& glyphIndices, std::vector<GlyphBitmap>& bitmaps)
+	{
+		std::filesystem::path path = GetPath(font, pixelSize, mode);
+		MappedFile file;
+		if (path.empty() || !file.Open(path) || file.GetSize() < sizeof(GlyphCacheHeader))
+			return false;
+
+		GlyphCacheHeader header;
+		std::memcpy(&header, file.GetData(), sizeof(header));
+		if (std::memcmp(header.Magic, s_Magic, sizeof(s_Magic)) != 0 || header.Version != s_Version
+			|| header.Backend != (uint32_t)font.GetBackend() || header.FontHash != font.GetContentHash()
+			|| header.PixelSize != pixelSize || header.Mode != (uint32_t)mode)
+			return false;
+
+		size_t pixelsStart = sizeof(GlyphCacheHeader) + (size_t)header.GlyphCount * sizeof(GlyphCacheRecord);
+		if (pixelsStart > file.GetSize())
+			return false;
+
+		const uint8_t* records = file.GetData() + sizeof(GlyphCacheHeader);
+		size_t pixelsSize = file.GetSize() - pixelsStart;
+
+		// Fill locals and hand them over only once every record checked out, a truncated or corrupt
+		// file leaves the caller's lists untouched
+		std::vector<uint32_t> loadedIndices(header.GlyphCount);
+		std::vector<GlyphBitmap> loadedBitmaps(header.GlyphCount);
+		for (uint32_t i = 0; i < header.GlyphCount; i++)
+		{
+			GlyphCacheRecord record;
+			std::memcpy(&record, records + (size_t)i * sizeof(record), sizeof(record));
+
+			size_t size = (size_t)record.Width * record.Height;
+			if (record.PixelOffset > pixelsSize || size > pixelsSize - record.PixelOffset)
+				return false;
+
+			GlyphBitmap& bitmap = loadedBitmaps[i];
+			loadedIndices[i] = record.GlyphIndex;
+			bitmap.Width = record.Width;
+			bitmap.Height = record.Height;
+			bitmap.BearingX = record.BearingX;
+			bitmap.BearingY = record.BearingY;
+			bitmap.Advance = record.Advance;
+			const uint8_t* pixels = file.GetData() + pixelsStart + record.PixelOffset;
+			bitmap.Pixels.assign(pixels, pixels + size);
+		}
+
+		glyphIndices.swap(loadedIndices);
+		bitmaps.swap(loadedBitmaps);
+		return true;
+	}
+
+	bool GlyphCache::Save(const Font& font, uint32_t pixelSize, GlyphRenderMode mode,
+		const std::vector<uint32_t>& glyphIndices, const std::vector<GlyphBitmap>& bitmaps)
+	{
+		namespace fs = std::filesystem;
+
+		fs::path path = GetPath(font, pixelSize, mode);
+		if (path.empty())
+			return false;
+
+		std::error_code error;
+		fs::create_directories(path.parent_path(), error);
+
+		GlyphCacheHeader header = {};
+		std::memcpy(header.Magic, s_Magic, sizeof(s_Magic));
+		header.Version = s_Version;
+		header.Backend = (uint32_t)font.GetBackend();
+		header.FontHash = font.GetContentHash();
+		header.PixelSize = pixelSize;
+		header.GlyphCount = (uint32_t)glyphIndices.size();
+		header.Mode = (uint32_t)mode;
+
+		std::vector<GlyphCacheRecord> records(glyphIndices.size());
+		uint32_t pixelOffset = 0;
+		for (size_t i = 0; i < records.size(); i++)
+		{
+			const GlyphBitmap& bitmap = bitmaps[i];
+			records[i] = { glyphIndices[i], (uint16_t)bitmap.Width, (uint16_t)bitmap.Height,
+				(int16_t)bitmap.BearingX, (int16_t)bitmap.BearingY, bitmap.Advance, pixelOffset };
+			pixelOffset += (uint32_t)bitmap.Pixels.size();
+		}
+
+		// Unique per process and thread (thread ids repeat across processes), two sessions warming
+		// the same font race only on the final rename
+		std::stringstream suffix;
+		suffix << ".tmp" << GetProcessID() << "-" << std::this_thread::get_id();
+		fs::path temporary = path;
+		temporary += suffix.str();
+
+		{
+			std::ofstream file(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!file.is_open())
+			{
+				PS_CORE_WARN("Failed to write glyph cache {0}", temporary.string());
+				return false;
+			}
+
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(records.data()), (std::streamsize)(records.size() * sizeof(GlyphCacheRecord)));
+			for (const GlyphBitmap& bitmap : bitmaps)
+				file.write(reinterpret_cast<const char*>(bitmap.Pixels.data()), (std::streamsize)bitmap.Pixels.size());
+
+			if (!file.good())
+			{
+				file.close();
+				fs::remove(temporary, error);
+				return false;
+			}
+		}
+
+		fs::rename(temporary, path, error);
+		if (error)
+		{
+			fs::remove(temporary, error);
+			return false;
+		}
+		return true;
+	}
+
+}
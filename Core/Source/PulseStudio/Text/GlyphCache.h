@@ -0,0 +1,37 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "Font.h"
+
+namespace PulseStudio {
+
+	/*
+	* Rasterized glyphs of one font at one pixel size, persisted between sessions so startup does
+	* not have to rasterize the common ranges again. Files live in the user's cache directory and
+	* are named after the font's content hash, the pixel size, the render mode and the rasterizer,
+	* so a changed font file or backend simply misses. Loading memory-maps the file and copies the
+	* bitmaps out.
+	*
+	* File   := Header Record[GlyphCount] pixels
+	* Header := magic[8] version:u32 backend:u32 fontHash:u64 pixelSize:u32 glyphCount:u32 mode:u32 reserved:u32
+	* Record := glyphIndex:u32 width:u16 height:u16 bearingX:i16 bearingY:i16 advance:f32 pixelOffset:u32
+	*/
+	class GlyphCache
+	{
+	public:
+		// Per-user cache directory, empty if there is no home or profile directory
+		static std::filesystem::path GetDirectory();
+		static std::filesystem::path GetPath(const Font& font, uint32_t pixelSize, GlyphRenderMode mode);
+
+		// Replace glyphIndices and bitmaps with the cache file's, false (and both left untouched) if
+		// it is missing, stale or corrupt
+		static bool Load(const Font& font, uint32_t pixelSize, GlyphRenderMode mode,
+			std::vector<uint32_t>& glyphIndices, std::vector<GlyphBitmap>& bitmaps);
+
+		// Write through a temporary file, so readers never see a partial cache. Any thread.
+		static bool Save(const Font& font, uint32_t pixelSize, GlyphRenderMode mode,
+			const std::vector<uint32_t>& glyphIndices, const std::vector<GlyphBitmap>& bitmaps);
+	};
+
+}
@@ -0,0 +1,160 @@
+#include "pspch.h"
+#include "TextLayout.h"
+
+#include "GlyphAtlas.h"
+#include "Utf8.h"
+#include "PulseStudio/Profiler.h"
+
+namespace PulseStudio {
+
+	ShapedRun::ShapedRun(std::span<const uint32_t> glyphs, std::span<const float> offsets, float width)
+		: m_Count((uint32_t)glyphs.size()), m_Width(width)
+	{
+		PS_CORE_ASSERT(glyphs.size() == offsets.size(), "Every glyph of a run needs an offset");
+
+		if (m_Count == 0)
+			return;
+
+		m_Data = std::make_unique<std::byte[]>(m_Count * (sizeof(uint32_t) + sizeof(float)));
+		std::memcpy(m_Data.get(), glyphs.data(), m_Count * sizeof(uint32_t));
+		std::memcpy(m_Data.get() + m_Count * sizeof(uint32_t), offsets.data(), m_Count * sizeof(float));
+	}
+
+	ShapedRunCache::ShapedRunCache(GlyphAtlas& atlas, uint32_t maxRuns)
+		: m_Atlas(atlas), m_MaxRuns(maxRuns)
+	{
+	}
+
+	void ShapedRunCache::BeginFrame()
+	{
+		if (m_Runs.size() > m_MaxRuns)
+			std::erase_if(m_Runs, [this](const auto& entry) { return entry.second.LastUsedFrame + 1 < m_Frame; });
+
+		m_FrameStats.Runs = (uint32_t)m_Runs.size();
+		m_LastFrameStats = m_FrameStats;
+		m_FrameStats = {};
+		m_Frame++;
+
+		Profiler::RecordCounter("Text runs shaped", m_LastFrameStats.Shaped);
+	}
+
+	std::shared_ptr<const ShapedRun> ShapedRunCache::GetRun(Font& font, uint32_t pixelSize, std::string_view text)
+	{
+		KeyView key;
+		key.Hash = std::hash<std::string_view>()(text);
+		key.FontID = font.GetID();
+		key.PixelSize = pixelSize;
+		key.Mode = font.GetRenderMode();
+		key.Text = text;
+
+		auto it = m_Runs.find(key);
+		if (it != m_Runs.end())
+		{
+			m_FrameStats.Hits++;
+			it->second.LastUsedFrame = m_Frame;
+			return it->second.Run;
+		}
+
+		PS_MEMORY_TAG(Text);
+		m_FrameStats.Shaped++;
+		std::shared_ptr<const ShapedRun> run = Shape(font, pixelSize, text);
+		m_Runs.emplace(Key{ key.Hash, key.FontID, key.PixelSize, key.Mode, std::string(text) }, Entry{ run, m_Frame });
+		return run;
+	}
+
+	std::shared_ptr<const ShapedRun> ShapedRunCache::Shape(Font& font, uint32_t pixelSize, std::string_view text)
+	{
+		PS_PROFILE_FUNCTION();
+
+		// Distance field metrics come at their base size, see TextRenderer::DrawText
+		bool distanceField = font.GetRenderMode() == GlyphRenderMode::DistanceField;
+		float scale = distanceField ? (float)pixelSize / Font::DistanceFieldSize : 1.0f;
+		uint32_t metricsSize = distanceField ? Font::DistanceFieldSize : pixelSize;
+
+		m_ScratchGlyphs.clear();
+		m_ScratchOffsets.clear();
+
+		float penX = 0.0f;
+		uint32_t previous = 0;
+		size_t offset = 0;
+		while (offset < text.size())
+		{
+			uint32_t glyphIndex = font.GetGlyphIndex(Utf8::DecodeNext(text, offset));
+			if (previous != 0 && glyphIndex != 0)
+				penX += font.GetKerning(previous, glyphIndex, metricsSize) * scale;
+			previous = glyphIndex;
+
+			const AtlasGlyph* glyph = m_Atlas.GetGlyph(font, glyphIndex, pixelSize);
+			if (!glyph)
+			{
+				// Could not be placed this time, keep it so a later draw can try again. The run is
+				// cached, so it still needs the advance the glyph will have once it is placed.
+				m_ScratchGlyphs.push_back(glyphIndex);
+				m_ScratchOffsets.push_back(penX);
+				penX += font.GetAdvance(glyphIndex, metricsSize, font.GetRenderMode()) * scale;
+				continue;
+			}
+
+			if (glyph->Region.TextureID != 0)
+			{
+				m_ScratchGlyphs.push_back(glyphIndex);
+				m_ScratchOffsets.push_back(penX);
+			}
+			penX += glyph->Advance * scale;
+		}
+
+		return std::make_shared<const ShapedRun>(m_ScratchGlyphs, m_ScratchOffsets, penX);
+	}
+
+	TextLayout::TextLayout(ShapedRunCache& cache)
+		: m_Cache(cache)
+	{
+	}
+
+	const ShapedRun& TextLayout::GetLine(uint32_t line, Font& font, uint32_t pixelSize, std::string_view text)
+	{
+		if (line >= m_Lines.size())
+			m_Lines.resize(line + 1);
+
+		Slot& slot = m_Lines[line];
+		if (!slot.Run || slot.FontID != font.GetID() || slot.PixelSize != pixelSize || slot.Mode != font.GetRenderMode())
+		{
+			PS_MEMORY_TAG(Text);
+			slot.Run = m_Cache.GetRun(font, pixelSize, text);
+			slot.FontID = font.GetID();
+			slot.PixelSize = pixelSize;
+			slot.Mode = font.GetRenderMode();
+		}
+		return *slot.Run;
+	}
+
+	void TextLayout::InvalidateLine(uint32_t line)
+	{
+		if (line < m_Lines.size())
+			m_Lines[line].Run.reset();
+	}
+
+	void TextLayout::InsertLines(uint32_t line, uint32_t count)
+	{
+		if (line >= m_Lines.size())
+			return;
+
+		PS_MEMORY_TAG(Text);
+		m_Lines.insert(m_Lines.begin() + line, count, Slot{});
+	}
+
+	void TextLayout::EraseLines(uint32_t line, uint32_t count)
+	{
+		if (line >= m_Lines.size())
+			return;
+
+		count = std::min(count, (uint32_t)m_Lines.size() - line);
+		m_Lines.erase(m_Lines.begin() + line, m_Lines.begin() + line + count);
+	}
+
+	void TextLayout::Clear()
+	{
+		m_Lines.clear();
+	}
+
+}
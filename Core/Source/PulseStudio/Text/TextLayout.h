@@ -0,0 +1,156 @@
+#pragma once
+
+#include "pspch.h"
+
+#include "Font.h"
+
+#include <span>
+
+namespace PulseStudio {
+
+	class GlyphAtlas;
+
+	/*
+	* Glyphs of one line of text positioned along the baseline: glyph indices and pen offsets in
+	* pixels, kerning applied. Blank glyphs are dropped, they only move the pen. Both arrays live
+	* in one allocation, glyph indices first, so drawing a run walks two flat arrays.
+	*/
+	class ShapedRun
+	{
+	public:
+		ShapedRun(std::span<const uint32_t> glyphs, std::span<const float> offsets, float width);
+
+		inline uint32_t GetGlyphCount() const { return m_Count; }
+		inline std::span<const uint32_t> GetGlyphs() const { return { reinterpret_cast<const uint32_t*>(m_Data.get()), m_Count }; }
+		inline std::span<const float> GetOffsets() const { return { reinterpret_cast<const float*>(m_Data.get() + m_Count * sizeof(uint32_t)), m_Count }; }
+		// Pen advance over the whole run
+		inline float GetWidth() const { return m_Width; }
+	private:
+		std::unique_ptr<std::byte[]> m_Data;
+		uint32_t m_Count = 0;
+		float m_Width = 0.0f;
+	};
+
+	struct ShapedRunCacheStats
+	{
+		uint32_t Hits = 0;
+		uint32_t Shaped = 0;	// Runs laid out from scratch
+		uint32_t Runs = 0;
+	};
+
+	/*
+	* Shaped runs keyed by font, pixel size, render mode and the UTF-8 text, so the same text is
+	* only laid out once no matter which line it shows up on (or comes back on, after an undo).
+	* Advances come from the glyph atlas, which rasterizes what it has not seen yet, or from the
+	* font for glyphs the atlas could not place. Once the cache holds more than maxRuns,
+	* BeginFrame() drops every run not used in the last frame. Main thread only.
+	*/
+	class ShapedRunCache
+	{
+	public:
+		ShapedRunCache(GlyphAtlas& atlas, uint32_t maxRuns = 4096);
+
+		// Rolls the per-frame counters and trims the cache
+		void BeginFrame();
+
+		std::shared_ptr<const ShapedRun> GetRun(Font& font, uint32_t pixelSize, std::string_view text);
+
+		inline const ShapedRunCacheStats& GetLastFrameStats() const { return m_LastFrameStats; }
+	private:
+		// Owns a copy of the text, which is compared on lookup, so a hash collision is only a miss
+		struct Key
+		{
+			uint64_t Hash = 0;
+			uint32_t FontID = 0;
+			uint32_t PixelSize = 0;
+			GlyphRenderMode Mode = GlyphRenderMode::Bitmap;
+			std::string Text;
+		};
+
+		// Finds a Key without copying the text
+		struct KeyView
+		{
+			uint64_t Hash = 0;
+			uint32_t FontID = 0;
+			uint32_t PixelSize = 0;
+			GlyphRenderMode Mode = GlyphRenderMode::Bitmap;
+			std::string_view Text;
+		};
+
+		struct KeyHash
+		{
+			using is_transparent = void;
+
+			template<typename K>
+			inline size_t operator()(const K& key) const
+			{
+				return (size_t)(key.Hash ^ ((uint64_t)key.FontID << 40) ^ ((uint64_t)key.PixelSize << 20) ^ (uint64_t)key.Mode);
+			}
+		};
+
+		struct KeyEqual
+		{
+			using is_transparent = void;
+
+			template<typename A, typename B>
+			inline bool operator()(const A& a, const B& b) const
+			{
+				return a.Hash == b.Hash && a.FontID == b.FontID && a.PixelSize == b.PixelSize && a.Mode == b.Mode
+					&& std::string_view(a.Text) == std::string_view(b.Text);
+			}
+		};
+
+		struct Entry
+		{
+			std::shared_ptr<const ShapedRun> Run;
+			uint64_t LastUsedFrame = 0;
+		};
+
+		std::shared_ptr<const ShapedRun> Shape(Font& font, uint32_t pixelSize, std::string_view text);
+
+		GlyphAtlas& m_Atlas;
+		uint32_t m_MaxRuns;
+		std::unordered_map<Key, Entry, KeyHash, KeyEqual> m_Runs;
+		uint64_t m_Frame = 1;
+
+		// Reused between runs so shaping allocates only the run itself
+		std::vector<uint32_t> m_ScratchGlyphs;
+		std::vector<float> m_ScratchOffsets;
+
+		ShapedRunCacheStats m_FrameStats;
+		ShapedRunCacheStats m_LastFrameStats;
+	};
+
+	/*
+	* Line-by-line layout of a document, one slot per line holding its shaped run. A slot is reused
+	* until its line is invalidated, so drawing an unchanged line costs neither hashing nor shaping
+	* and layout work follows the edits rather than the number of visible lines. The owner of the
+	* text reports every edit: InvalidateLine() for a line whose text changed, InsertLines() and
+	* EraseLines() when lines move. Drawing with another font or pixel size reshapes lines lazily.
+	*/
+	class TextLayout
+	{
+	public:
+		TextLayout(ShapedRunCache& cache);
+
+		// Run of the line, looked up again only if the line changed since it was last laid out
+		const ShapedRun& GetLine(uint32_t line, Font& font, uint32_t pixelSize, std::string_view text);
+
+		void InvalidateLine(uint32_t line);
+		void InsertLines(uint32_t line, uint32_t count);
+		void EraseLines(uint32_t line, uint32_t count);
+		void Clear();
+	private:
+		struct Slot
+		{
+			std::shared_ptr<const ShapedRun> Run;
+			uint32_t FontID = 0;
+			uint32_t PixelSize = 0;
+			GlyphRenderMode Mode = GlyphRenderMode::Bitmap;
+		};
+
+		ShapedRunCache& m_Cache;
+		std::vector<Slot> m_Lines;
+	};
+
+}
@@ -0,0 +1,75 @@
+#include "pspch.h"
+#include "TextRenderer.h"
+
+#include "Font.h"
+#include "GlyphAtlas.h"
+#include "TextLayout.h"
+#include "Utf8.h"
+#include "PulseStudio/Renderer/Batch2D.h"
+
+namespace PulseStudio {
+
+	// Distance field glyphs come at their base size, everything else at pixelSize
+	static inline float GetGlyphScale(const Font& font, uint32_t pixelSize)
+	{
+		return font.GetRenderMode() == GlyphRenderMode::DistanceField ? (float)pixelSize / Font::DistanceFieldSize : 1.0f;
+	}
+
+	static inline void DrawGlyph(Batch2D& batch, const AtlasGlyph& glyph, const glm::vec2& pen, float scale, const glm::vec4& color)
+	{
+		if (glyph.Region.TextureID == 0)
+			return;
+
+		if (glyph.DistanceField)
+		{
+			batch.DrawDistanceField(pen + glyph.Offset * scale, glyph.Size * scale, glyph.Region, color);
+		}
+		else
+		{
+			// Snap to whole pixels, glyph bitmaps map 1:1 onto the screen
+			glm::vec2 origin = glm::floor(pen + glyph.Offset + 0.5f);
+			batch.DrawQuad(origin, glyph.Size, glyph.Region, color);
+		}
+	}
+
+	float TextRenderer::DrawText(Batch2D& batch, GlyphAtlas& atlas, Font& font, uint32_t pixelSize,
+		const glm::vec2& position, std::string_view text, const glm::vec4& color)
+	{
+		float scale = GetGlyphScale(font, pixelSize);
+
+		float penX = position.x;
+		size_t offset = 0;
+		while (offset < text.size())
+		{
+			uint32_t codepoint = Utf8::DecodeNext(text, offset);
+			const AtlasGlyph* glyph = atlas.GetGlyph(font, font.GetGlyphIndex(codepoint), pixelSize);
+			if (!glyph)
+				continue;
+
+			DrawGlyph(batch, *glyph, { penX, position.y }, scale, color);
+			penX += glyph->Advance * scale;
+		}
+
+		// Glyphs new to the atlas reach the GPU with one upload per page
+		atlas.Upload();
+		return penX - position.x;
+	}
+
+	float TextRenderer::DrawRun(Batch2D& batch, GlyphAtlas& atlas, Font& font, uint32_t pixelSize,
+		const glm::vec2& position, const ShapedRun& run, const glm::vec4& color)
+	{
+		float scale = GetGlyphScale(font, pixelSize);
+
+		std::span<const uint32_t> glyphs = run.GetGlyphs();
+		std::span<const float> offsets = run.GetOffsets();
+		for (size_t i = 0; i < glyphs.size(); i++)
+		{
+			if (const AtlasGlyph* glyph = atlas.GetGlyph(font, glyphs[i], pixelSize))
+				DrawGlyph(batch, *glyph, { position.x + offsets[i], position.y }, scale, color);
+		}
+
+		atlas.Upload();
+		return run.GetWidth();
+	}
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "pspch.h"
+
+#include <glm/glm.hpp>
+
+namespace PulseStudio {
+
+	class Batch2D;
+	class Font;
+	class GlyphAtlas;
+	class ShapedRun;
+
+	// Immediate text drawing on top of the glyph atlas, main thread only
+	class TextRenderer
+	{
+	public:
+		// Draw one line of UTF-8 text with the baseline starting at position, glyph by glyph without
+		// kerning. Returns the advance.
+		static float DrawText(Batch2D& batch, GlyphAtlas& atlas, Font& font, uint32_t pixelSize,
+			const glm::vec2& position, std::string_view text, const glm::vec4& color);
+
+		// Draw a run laid out by a ShapedRunCache with the same font and pixel size, only the atlas
+		// is consulted per glyph. Returns the advance.
+		static float DrawRun(Batch2D& batch, GlyphAtlas& atlas, Font& font, uint32_t pixelSize,
+			const glm::vec2& position, const ShapedRun& run, const glm::vec4& color);
+	};
+
+}
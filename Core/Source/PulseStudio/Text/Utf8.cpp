@@ -0,0 +1,690 @@
+#include "pspch.h"
+#include "Utf8.h"
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#define PS_UTF8_SIMD 1
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#else
+	#define PS_UTF8_SIMD 0
+#endif
+
+// MSVC compiles intrinsics for any instruction set, GCC and Clang only inside functions marked for it
+#if PS_UTF8_SIMD && (defined(__GNUC__) || defined(__clang__))
+	#define PS_TARGET_SSE41 __attribute__((target("sse4.1")))
+	#define PS_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define PS_TARGET_SSE41
+	#define PS_TARGET_AVX2
+#endif
+
+namespace PulseStudio::Utf8 {
+
+	static inline bool IsContinuation(uint8_t byte)
+	{
+		return (byte & 0xC0) == 0x80;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// Scalar ////////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////////
+
+	static size_t ValidateFrom(const uint8_t* data, size_t size, size_t offset)
+	{
+		while (offset < size)
+		{
+			if (data[offset] < 0x80)
+			{
+				offset++;
+				continue;
+			}
+
+			uint32_t codepoint;
+			size_t length = DecodeSequence(data + offset, size - offset, codepoint);
+			if (length == 0)
+				return offset;
+			offset += length;
+		}
+		return size;
+	}
+
+	static size_t DecodeRange(const uint8_t* data, size_t size, size_t& offset, uint32_t* output, size_t count, size_t end, size_t capacity)
+	{
+		while (offset < end && count < capacity)
+		{
+			uint32_t codepoint;
+			size_t length = DecodeSequence(data + offset, size - offset, codepoint);
+			output[count++] = length ? codepoint : ReplacementCharacter;
+			offset += length ? length : 1;
+		}
+		return count;
+	}
+
+	static size_t ValidateScalar(const uint8_t* data, size_t size)
+	{
+		return ValidateFrom(data, size, 0);
+	}
+
+	static size_t CountCodepointsScalar(const uint8_t* data, size_t size)
+	{
+		size_t count = 0;
+		for (size_t i = 0; i < size; i++)
+			count += !IsContinuation(data[i]);
+		return count;
+	}
+
+	static size_t DecodeScalar(const uint8_t* data, size_t size, uint32_t* output, size_t capacity)
+	{
+		size_t offset = 0;
+		return DecodeRange(data, size, offset, output, 0, size, capacity);
+	}
+
+	static size_t FindNewlineScalar(const uint8_t* data, size_t size, size_t offset)
+	{
+		const void* found = std::memchr(data + offset, '\n', size - offset);
+		return found ? (size_t)(static_cast<const uint8_t*>(found) - data) : size;
+	}
+
+	static size_t CountNewlinesScalar(const uint8_t* data, size_t size)
+	{
+		return (size_t)std::count(data, data + size, (uint8_t)'\n');
+	}
+
+	// The vector validators only know which 64 byte chunk failed. The chunk start may sit inside a
+	// sequence that began up to three bytes earlier, so rescan from the last lead byte before it.
+	static size_t LocateError(const uint8_t* data, size_t size, size_t chunk)
+	{
+		size_t start = chunk;
+		for (size_t back = 1; back <= 3 && back <= chunk; back++)
+		{
+			if (!IsContinuation(data[chunk - back]))
+			{
+				start = chunk - back;
+				break;
+			}
+		}
+		return ValidateFrom(data, size, start);
+	}
+
+#if PS_UTF8_SIMD
+
+	/*
+	* Validation follows Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per
+	* Byte". Every error shows up in the high nibble of a byte, the low nibble of the byte before
+	* and the high nibble of the byte before that, so three 16 entry lookups and'ed together flag
+	* all malformed two byte patterns. Third and fourth bytes of long sequences are checked by
+	* comparing the continuation bits against the lead bytes two and three positions back.
+	*/
+	namespace ValidationTables {
+
+		static constexpr uint8_t TooShort = 1 << 0;		// Lead or ASCII followed by a lead or ASCII
+		static constexpr uint8_t TooLong = 1 << 1;		// ASCII followed by a continuation
+		static constexpr uint8_t Overlong3 = 1 << 2;	// 11100000 100_____
+		static constexpr uint8_t TooLarge = 1 << 3;		// Past U+10FFFF
+		static constexpr uint8_t Surrogate = 1 << 4;	// 11101101 101_____
+		static constexpr uint8_t Overlong2 = 1 << 5;	// 1100000_ 10______
+		static constexpr uint8_t TooLarge1000 = 1 << 6;
+		static constexpr uint8_t Overlong4 = 1 << 6;	// 11110000 1000____
+		static constexpr uint8_t TwoContinuations = 1 << 7;
+		static constexpr uint8_t Carry = TooShort | TooLong | TwoContinuations;
+
+		alignas(16) static constexpr uint8_t Byte1High[16] = {
+			TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+			TwoContinuations, TwoContinuations, TwoContinuations, TwoContinuations,
+			TooShort | Overlong2,
+			TooShort,
+			TooShort | Overlong3 | Surrogate,
+			TooShort | TooLarge | TooLarge1000 | Overlong4
+		};
+
+		alignas(16) static constexpr uint8_t Byte1Low[16] = {
+			Carry | Overlong3 | Overlong2 | Overlong4,
+			Carry | Overlong2,
+			Carry,
+			Carry,
+			Carry | TooLarge,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000 | Surrogate,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000
+		};
+
+		alignas(16) static constexpr uint8_t Byte2High[16] = {
+			TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+			TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge1000 | Overlong4,
+			TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge,
+			TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge,
+			TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge,
+			TooShort, TooShort, TooShort, TooShort
+		};
+
+		// Anything above these in the last three bytes of a block starts a sequence the block cuts off
+		alignas(32) static constexpr uint8_t IncompleteLimits[32] = {
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+		};
+
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// SSE4.1 ////////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////////
+
+	struct ValidatorSSE41
+	{
+		__m128i Error;
+		__m128i Previous;
+		__m128i PreviousIncomplete;
+	};
+
+	PS_TARGET_SSE41 static inline void CheckBlockSSE41(ValidatorSSE41& state, __m128i input)
+	{
+		using namespace ValidationTables;
+
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		__m128i prev1 = _mm_alignr_epi8(input, state.Previous, 15);
+		__m128i byte1High = _mm_shuffle_epi8(_mm_load_si128((const __m128i*)Byte1High), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+		__m128i byte1Low = _mm_shuffle_epi8(_mm_load_si128((const __m128i*)Byte1Low), _mm_and_si128(prev1, nibble));
+		__m128i byte2High = _mm_shuffle_epi8(_mm_load_si128((const __m128i*)Byte2High), _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+		__m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+		// Only 111_____ and 1111____ two and three bytes back leave the top bit set
+		__m128i third = _mm_subs_epu8(_mm_alignr_epi8(input, state.Previous, 14), _mm_set1_epi8((char)(0xE0 - 0x80)));
+		__m128i fourth = _mm_subs_epu8(_mm_alignr_epi8(input, state.Previous, 13), _mm_set1_epi8((char)(0xF0 - 0x80)));
+		__m128i mustContinue = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+
+		state.Error = _mm_or_si128(state.Error, _mm_xor_si128(mustContinue, special));
+		state.PreviousIncomplete = _mm_subs_epu8(input, _mm_loadu_si128((const __m128i*)(ValidationTables::IncompleteLimits + 16)));
+		state.Previous = input;
+	}
+
+	PS_TARGET_SSE41 static inline bool CheckChunkSSE41(ValidatorSSE41& state, const uint8_t* chunk)
+	{
+		__m128i block[4];
+		for (int i = 0; i < 4; i++)
+			block[i] = _mm_loadu_si128((const __m128i*)(chunk + i * 16));
+
+		__m128i any = _mm_or_si128(_mm_or_si128(block[0], block[1]), _mm_or_si128(block[2], block[3]));
+		if (_mm_movemask_epi8(any) == 0)
+		{
+			// ASCII only, fine unless the last chunk cut a sequence off
+			state.Error = _mm_or_si128(state.Error, state.PreviousIncomplete);
+			state.Previous = block[3];
+		}
+		else
+		{
+			for (int i = 0; i < 4; i++)
+				CheckBlockSSE41(state, block[i]);
+		}
+		return _mm_testz_si128(state.Error, state.Error);
+	}
+
+	PS_TARGET_SSE41 static size_t ValidateSSE41(const uint8_t* data, size_t size)
+	{
+		ValidatorSSE41 state = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+
+		size_t offset = 0;
+		for (; offset + 64 <= size; offset += 64)
+		{
+			if (!CheckChunkSSE41(state, data + offset))
+				return LocateError(data, size, offset);
+		}
+
+		// The zero padding flags a sequence cut off by the end of the text as too short
+		alignas(16) uint8_t tail[64] = {};
+		std::memcpy(tail, data + offset, size - offset);
+		if (!CheckChunkSSE41(state, tail))
+			return LocateError(data, size, offset);
+		return size;
+	}
+
+	// Sums 0/1 bytes (0/-1 from a compare) without leaving the vector unit, 255 blocks per flush
+	template<bool Newlines>
+	PS_TARGET_SSE41 static size_t CountSSE41(const uint8_t* data, size_t size)
+	{
+		size_t total = 0;
+		size_t offset = 0;
+		while (offset + 16 <= size)
+		{
+			__m128i sum = _mm_setzero_si128();
+			size_t end = offset + std::min<size_t>((size - offset) / 16, 255) * 16;
+			for (; offset < end; offset += 16)
+			{
+				__m128i bytes = _mm_loadu_si128((const __m128i*)(data + offset));
+				__m128i match = Newlines ? _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'))
+					: _mm_cmpgt_epi8(bytes, _mm_set1_epi8((char)0xBF));
+				sum = _mm_sub_epi8(sum, match);
+			}
+			__m128i total64 = _mm_sad_epu8(sum, _mm_setzero_si128());
+			total += (size_t)_mm_cvtsi128_si64(total64) + (size_t)_mm_extract_epi64(total64, 1);
+		}
+
+		return total + (Newlines ? CountNewlinesScalar(data + offset, size - offset) : CountCodepointsScalar(data + offset, size - offset));
+	}
+
+	PS_TARGET_SSE41 static size_t CountCodepointsSSE41(const uint8_t* data, size_t size)
+	{
+		return CountSSE41<false>(data, size);
+	}
+
+	PS_TARGET_SSE41 static size_t CountNewlinesSSE41(const uint8_t* data, size_t size)
+	{
+		return CountSSE41<true>(data, size);
+	}
+
+	// Lanes of four bytes laid out as (third, second, lead, 0) back into code points, rejecting
+	// overlong forms and surrogates exactly like DecodeSequence()
+	PS_TARGET_SSE41 static inline __m128i Assemble3ByteSSE41(__m128i lanes, __m128i& invalid)
+	{
+		__m128i codepoints = _mm_or_si128(_mm_or_si128(
+			_mm_and_si128(lanes, _mm_set1_epi32(0x003F)),
+			_mm_and_si128(_mm_srli_epi32(lanes, 2), _mm_set1_epi32(0x0FC0))),
+			_mm_and_si128(_mm_srli_epi32(lanes, 4), _mm_set1_epi32(0xF000)));
+
+		__m128i overlong = _mm_cmplt_epi32(codepoints, _mm_set1_epi32(0x0800));
+		__m128i surrogate = _mm_and_si128(_mm_cmpgt_epi32(codepoints, _mm_set1_epi32(0xD7FF)), _mm_cmplt_epi32(codepoints, _mm_set1_epi32(0xE000)));
+		invalid = _mm_or_si128(overlong, surrogate);
+		return codepoints;
+	}
+
+	// Four three byte sequences at the start of bytes, the bulk of CJK text. False if the first
+	// twelve bytes are anything else.
+	PS_TARGET_SSE41 static inline bool Decode3ByteSSE41(__m128i bytes, uint32_t* output)
+	{
+		const __m128i mask = _mm_setr_epi8((char)0xF0, (char)0xC0, (char)0xC0, (char)0xF0, (char)0xC0, (char)0xC0,
+			(char)0xF0, (char)0xC0, (char)0xC0, (char)0xF0, (char)0xC0, (char)0xC0, 0, 0, 0, 0);
+		const __m128i pattern = _mm_setr_epi8((char)0xE0, (char)0x80, (char)0x80, (char)0xE0, (char)0x80, (char)0x80,
+			(char)0xE0, (char)0x80, (char)0x80, (char)0xE0, (char)0x80, (char)0x80, 0, 0, 0, 0);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, mask), pattern)) != 0xFFFF)
+			return false;
+
+		__m128i lanes = _mm_shuffle_epi8(bytes, _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1));
+		__m128i invalid;
+		__m128i codepoints = Assemble3ByteSSE41(lanes, invalid);
+		if (!_mm_testz_si128(invalid, invalid))
+			return false;
+
+		_mm_storeu_si128((__m128i*)output, codepoints);
+		return true;
+	}
+
+	// ASCII widens straight into the output, runs of three byte sequences go four at a time and
+	// everything else one sequence at a time
+	PS_TARGET_SSE41 static size_t DecodeSSE41(const uint8_t* data, size_t size, uint32_t* output, size_t capacity)
+	{
+		size_t offset = 0;
+		size_t count = 0;
+		while (offset + 16 <= size && count + 16 <= capacity)
+		{
+			__m128i bytes = _mm_loadu_si128((const __m128i*)(data + offset));
+			uint32_t nonAscii = (uint32_t)_mm_movemask_epi8(bytes);
+			if (nonAscii & 1)
+			{
+				if (Decode3ByteSSE41(bytes, output + count))
+				{
+					offset += 12;
+					count += 4;
+				}
+				else
+				{
+					count = DecodeRange(data, size, offset, output, count, offset + 1, capacity);
+				}
+				continue;
+			}
+
+			// Widen all sixteen, keep the ASCII ones in front
+			_mm_storeu_si128((__m128i*)(output + count), _mm_cvtepu8_epi32(bytes));
+			_mm_storeu_si128((__m128i*)(output + count + 4), _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4)));
+			_mm_storeu_si128((__m128i*)(output + count + 8), _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 8)));
+			_mm_storeu_si128((__m128i*)(output + count + 12), _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 12)));
+			size_t ascii = nonAscii ? (size_t)std::countr_zero(nonAscii) : 16;
+			offset += ascii;
+			count += ascii;
+		}
+		return DecodeRange(data, size, offset, output, count, size, capacity);
+	}
+
+	PS_TARGET_SSE41 static size_t FindNewlineSSE41(const uint8_t* data, size_t size, size_t offset)
+	{
+		const __m128i newline = _mm_set1_epi8('\n');
+		for (; offset + 16 <= size; offset += 16)
+		{
+			int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + offset)), newline));
+			if (mask != 0)
+				return offset + std::countr_zero((uint32_t)mask);
+		}
+		return FindNewlineScalar(data, size, offset);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// AVX2 //////////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////////
+
+	struct ValidatorAVX2
+	{
+		__m256i Error;
+		__m256i Previous;
+		__m256i PreviousIncomplete;
+	};
+
+	// Input shifted by N bytes with the tail of the previous block shifted in
+	template<int N>
+	PS_TARGET_AVX2 static inline __m256i PreviousAVX2(__m256i input, __m256i previous)
+	{
+		return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - N);
+	}
+
+	PS_TARGET_AVX2 static inline __m256i LookupAVX2(const uint8_t* table, __m256i index)
+	{
+		return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)table)), index);
+	}
+
+	PS_TARGET_AVX2 static inline void CheckBlockAVX2(ValidatorAVX2& state, __m256i input)
+	{
+		using namespace ValidationTables;
+
+		const __m256i nibble = _mm256_set1_epi8(0x0F);
+		__m256i prev1 = PreviousAVX2<1>(input, state.Previous);
+		__m256i byte1High = LookupAVX2(Byte1High, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+		__m256i byte1Low = LookupAVX2(Byte1Low, _mm256_and_si256(prev1, nibble));
+		__m256i byte2High = LookupAVX2(Byte2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+		__m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+		__m256i third = _mm256_subs_epu8(PreviousAVX2<2>(input, state.Previous), _mm256_set1_epi8((char)(0xE0 - 0x80)));
+		__m256i fourth = _mm256_subs_epu8(PreviousAVX2<3>(input, state.Previous), _mm256_set1_epi8((char)(0xF0 - 0x80)));
+		__m256i mustContinue = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+
+		state.Error = _mm256_or_si256(state.Error, _mm256_xor_si256(mustContinue, special));
+		state.PreviousIncomplete = _mm256_subs_epu8(input, _mm256_load_si256((const __m256i*)IncompleteLimits));
+		state.Previous = input;
+	}
+
+	PS_TARGET_AVX2 static inline bool CheckChunkAVX2(ValidatorAVX2& state, const uint8_t* chunk)
+	{
+		__m256i low = _mm256_loadu_si256((const __m256i*)chunk);
+		__m256i high = _mm256_loadu_si256((const __m256i*)(chunk + 32));
+		if (_mm256_movemask_epi8(_mm256_or_si256(low, high)) == 0)
+		{
+			state.Error = _mm256_or_si256(state.Error, state.PreviousIncomplete);
+			state.Previous = high;
+		}
+		else
+		{
+			CheckBlockAVX2(state, low);
+			CheckBlockAVX2(state, high);
+		}
+		return _mm256_testz_si256(state.Error, state.Error);
+	}
+
+	PS_TARGET_AVX2 static size_t ValidateAVX2(const uint8_t* data, size_t size)
+	{
+		ValidatorAVX2 state = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+
+		size_t offset = 0;
+		for (; offset + 64 <= size; offset += 64)
+		{
+			if (!CheckChunkAVX2(state, data + offset))
+				return LocateError(data, size, offset);
+		}
+
+		alignas(32) uint8_t tail[64] = {};
+		std::memcpy(tail, data + offset, size - offset);
+		if (!CheckChunkAVX2(state, tail))
+			return LocateError(data, size, offset);
+		return size;
+	}
+
+	template<bool Newlines>
+	PS_TARGET_AVX2 static size_t CountAVX2(const uint8_t* data, size_t size)
+	{
+		size_t total = 0;
+		size_t offset = 0;
+		while (offset + 32 <= size)
+		{
+			__m256i sum = _mm256_setzero_si256();
+			size_t end = offset + std::min<size_t>((size - offset) / 32, 255) * 32;
+			for (; offset < end; offset += 32)
+			{
+				__m256i bytes = _mm256_loadu_si256((const __m256i*)(data + offset));
+				__m256i match = Newlines ? _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n'))
+					: _mm256_cmpgt_epi8(bytes, _mm256_set1_epi8((char)0xBF));
+				sum = _mm256_sub_epi8(sum, match);
+			}
+			__m256i total64 = _mm256_sad_epu8(sum, _mm256_setzero_si256());
+			total += (size_t)_mm256_extract_epi64(total64, 0) + (size_t)_mm256_extract_epi64(total64, 1)
+				+ (size_t)_mm256_extract_epi64(total64, 2) + (size_t)_mm256_extract_epi64(total64, 3);
+		}
+
+		return total + (Newlines ? CountNewlinesScalar(data + offset, size - offset) : CountCodepointsScalar(data + offset, size - offset));
+	}
+
+	PS_TARGET_AVX2 static size_t CountCodepointsAVX2(const uint8_t* data, size_t size)
+	{
+		return CountAVX2<false>(data, size);
+	}
+
+	PS_TARGET_AVX2 static size_t CountNewlinesAVX2(const uint8_t* data, size_t size)
+	{
+		return CountAVX2<true>(data, size);
+	}
+
+	// Eight three byte sequences, twelve bytes per 128 bit lane
+	PS_TARGET_AVX2 static inline bool Decode3ByteAVX2(const uint8_t* bytes, uint32_t* output)
+	{
+		const __m256i mask = _mm256_broadcastsi128_si256(_mm_setr_epi8((char)0xF0, (char)0xC0, (char)0xC0, (char)0xF0, (char)0xC0, (char)0xC0,
+			(char)0xF0, (char)0xC0, (char)0xC0, (char)0xF0, (char)0xC0, (char)0xC0, 0, 0, 0, 0));
+		const __m256i pattern = _mm256_broadcastsi128_si256(_mm_setr_epi8((char)0xE0, (char)0x80, (char)0x80, (char)0xE0, (char)0x80, (char)0x80,
+			(char)0xE0, (char)0x80, (char)0x80, (char)0xE0, (char)0x80, (char)0x80, 0, 0, 0, 0));
+
+		__m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)bytes)),
+			_mm_loadu_si128((const __m128i*)(bytes + 12)), 1);
+		if ((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(input, mask), pattern)) != 0xFFFFFFFF)
+			return false;
+
+		__m256i lanes = _mm256_shuffle_epi8(input, _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)));
+		__m256i codepoints = _mm256_or_si256(_mm256_or_si256(
+			_mm256_and_si256(lanes, _mm256_set1_epi32(0x003F)),
+			_mm256_and_si256(_mm256_srli_epi32(lanes, 2), _mm256_set1_epi32(0x0FC0))),
+			_mm256_and_si256(_mm256_srli_epi32(lanes, 4), _mm256_set1_epi32(0xF000)));
+
+		__m256i overlong = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x0800), codepoints);
+		__m256i surrogate = _mm256_and_si256(_mm256_cmpgt_epi32(codepoints, _mm256_set1_epi32(0xD7FF)), _mm256_cmpgt_epi32(_mm256_set1_epi32(0xE000), codepoints));
+		__m256i invalid = _mm256_or_si256(overlong, surrogate);
+		if (!_mm256_testz_si256(invalid, invalid))
+			return false;
+
+		_mm256_storeu_si256((__m256i*)output, codepoints);
+		return true;
+	}
+
+	PS_TARGET_AVX2 static size_t DecodeAVX2(const uint8_t* data, size_t size, uint32_t* output, size_t capacity)
+	{
+		size_t offset = 0;
+		size_t count = 0;
+		while (offset + 32 <= size && count + 32 <= capacity)
+		{
+			__m256i bytes = _mm256_loadu_si256((const __m256i*)(data + offset));
+			uint32_t nonAscii = (uint32_t)_mm256_movemask_epi8(bytes);
+			if (nonAscii & 1)
+			{
+				if (Decode3ByteAVX2(data + offset, output + count))
+				{
+					offset += 24;
+					count += 8;
+				}
+				else if (Decode3ByteSSE41(_mm256_castsi256_si128(bytes), output + count))
+				{
+					offset += 12;
+					count += 4;
+				}
+				else
+				{
+					count = DecodeRange(data, size, offset, output, count, offset + 1, capacity);
+				}
+				continue;
+			}
+
+			for (int i = 0; i < 4; i++)
+			{
+				__m128i eight = _mm_loadl_epi64((const __m128i*)(data + offset + i * 8));
+				_mm256_storeu_si256((__m256i*)(output + count + i * 8), _mm256_cvtepu8_epi32(eight));
+			}
+			size_t ascii = nonAscii ? (size_t)std::countr_zero(nonAscii) : 32;
+			offset += ascii;
+			count += ascii;
+		}
+		return DecodeRange(data, size, offset, output, count, size, capacity);
+	}
+
+	PS_TARGET_AVX2 static size_t FindNewlineAVX2(const uint8_t* data, size_t size, size_t offset)
+	{
+		const __m256i newline = _mm256_set1_epi8('\n');
+		for (; offset + 32 <= size; offset += 32)
+		{
+			int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(data + offset)), newline));
+			if (mask != 0)
+				return offset + std::countr_zero((uint32_t)mask);
+		}
+		return FindNewlineScalar(data, size, offset);
+	}
+
+#endif
+
+	//////////////////////////////////////////////////////////////////////////////
+	// Dispatch //////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////////
+
+	struct KernelTable
+	{
+		size_t (*Validate)(const uint8_t* data, size_t size);
+		size_t (*CountCodepoints)(const uint8_t* data, size_t size);
+		size_t (*Decode)(const uint8_t* data, size_t size, uint32_t* output, size_t capacity);
+		size_t (*FindNewline)(const uint8_t* data, size_t size, size_t offset);
+		size_t (*CountNewlines)(const uint8_t* data, size_t size);
+	};
+
+	static constexpr KernelTable s_Kernels[] = {
+		{ ValidateScalar, CountCodepointsScalar, DecodeScalar, FindNewlineScalar, CountNewlinesScalar },
+#if PS_UTF8_SIMD
+		{ ValidateSSE41, CountCodepointsSSE41, DecodeSSE41, FindNewlineSSE41, CountNewlinesSSE41 },
+		{ ValidateAVX2, CountCodepointsAVX2, DecodeAVX2, FindNewlineAVX2, CountNewlinesAVX2 },
+#endif
+	};
+
+	static Kernel DetectKernel()
+	{
+#if PS_UTF8_SIMD
+	#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		int maxLeaf = info[0];
+		__cpuid(info, 1);
+		bool sse41 = (info[2] & (1 << 19)) != 0;
+		// AVX2 also needs the OS to save the upper halves of the ymm registers
+		bool avxState = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+		bool avx2 = false;
+		if (avxState && maxLeaf >= 7)
+		{
+			__cpuidex(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+		}
+	#else
+		__builtin_cpu_init();
+		bool sse41 = __builtin_cpu_supports("sse4.1");
+		bool avx2 = __builtin_cpu_supports("avx2");
+	#endif
+		if (avx2)
+			return Kernel::AVX2;
+		if (sse41)
+			return Kernel::SSE41;
+#endif
+		return Kernel::Scalar;
+	}
+
+	static Kernel GetSupportedKernel()
+	{
+		static const Kernel s_Supported = DetectKernel();
+		return s_Supported;
+	}
+
+	static std::atomic<const KernelTable*> s_Active = nullptr;
+
+	static const KernelTable& GetKernels()
+	{
+		const KernelTable* kernels = s_Active.load(std::memory_order_relaxed);
+		if (!kernels)
+		{
+			kernels = &s_Kernels[(int)GetSupportedKernel()];
+			s_Active.store(kernels, std::memory_order_relaxed);
+		}
+		return *kernels;
+	}
+
+	Kernel GetKernel()
+	{
+		return (Kernel)(&GetKernels() - s_Kernels);
+	}
+
+	void SetKernel(Kernel kernel)
+	{
+		Kernel supported = GetSupportedKernel();
+		if ((int)kernel > (int)supported)
+		{
+			PS_CORE_WARN("UTF-8 kernel {0} is not supported by this CPU, using {1}", GetKernelName(kernel), GetKernelName(supported));
+			kernel = supported;
+		}
+		s_Active.store(&s_Kernels[(int)kernel], std::memory_order_relaxed);
+	}
+
+	const char* GetKernelName(Kernel kernel)
+	{
+		switch (kernel)
+		{
+			case Kernel::Scalar: return "Scalar";
+			case Kernel::SSE41: return "SSE4.1";
+			case Kernel::AVX2: return "AVX2";
+		}
+		return "Unknown";
+	}
+
+	size_t Validate(std::string_view text)
+	{
+		return GetKernels().Validate(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+	}
+
+	size_t CountCodepoints(std::string_view text)
+	{
+		return GetKernels().CountCodepoints(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+	}
+
+	size_t Decode(std::string_view text, std::span<uint32_t> output)
+	{
+		return GetKernels().Decode(reinterpret_cast<const uint8_t*>(text.data()), text.size(), output.data(), output.size());
+	}
+
+	size_t FindNewline(std::string_view text, size_t offset)
+	{
+		if (offset >= text.size())
+			return text.size();
+		return GetKernels().FindNewline(reinterpret_cast<const uint8_t*>(text.data()), text.size(), offset);
+	}
+
+	size_t CountNewlines(std::string_view text)
+	{
+		return GetKernels().CountNewlines(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+	}
+
+}
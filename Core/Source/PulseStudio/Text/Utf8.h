@@ -0,0 +1,137 @@
+#pragma once
+
+#include "pspch.h"
+
+#include <span>
+
+namespace PulseStudio::Utf8 {
+
+	inline constexpr uint32_t ReplacementCharacter = 0xFFFD;
+
+	/*
+	* Bulk kernels come in a scalar version and SSE4.1 and AVX2 versions for x64. The fastest one
+	* the CPU supports is picked on first use, SetKernel() overrides that for benchmarks. All of
+	* them give the same results and can be called from any thread.
+	*/
+	enum class Kernel
+	{
+		Scalar = 0,
+		SSE41,
+		AVX2
+	};
+
+	Kernel GetKernel();
+	// Falls back to the best kernel the CPU supports if it does not support this one
+	void SetKernel(Kernel kernel);
+	const char* GetKernelName(Kernel kernel);
+
+	// Offset of the first malformed sequence, text.size() if the whole text is well-formed.
+	// Overlong forms, surrogates and code points past U+10FFFF are malformed.
+	size_t Validate(std::string_view text);
+	inline bool IsValid(std::string_view text) { return Validate(text) == text.size(); }
+
+	// Counts the bytes that are not continuation bytes, exact for well-formed text
+	size_t CountCodepoints(std::string_view text);
+
+	// Decodes text into output with malformed bytes as U+FFFD, like DecodeNext(). Well-formed text
+	// needs CountCodepoints(text) entries, anything else at most text.size(). Stops when output is
+	// full, returns the number of code points written.
+	size_t Decode(std::string_view text, std::span<uint32_t> output);
+
+	// Offset of the next '\n' at or after offset, text.size() if there is none. The '\r' of a
+	// "\r\n" line end is left to the caller.
+	size_t FindNewline(std::string_view text, size_t offset = 0);
+	size_t CountNewlines(std::string_view text);
+
+	// Length of the well-formed sequence at the start of bytes and its code point, 0 if the
+	// sequence is malformed or runs past available
+	inline size_t DecodeSequence(const uint8_t* bytes, size_t available, uint32_t& codepoint)
+	{
+		uint8_t lead = bytes[0];
+		if (lead < 0x80)
+		{
+			codepoint = lead;
+			return 1;
+		}
+
+		// The second byte carries the overlong, surrogate and range limits of its lead byte
+		size_t length;
+		uint8_t low = 0x80, high = 0xBF;
+		if (lead < 0xC2)
+			return 0;
+		else if (lead < 0xE0)
+			length = 2;
+		else if (lead < 0xF0)
+		{
+			length = 3;
+			low = lead == 0xE0 ? 0xA0 : 0x80;
+			high = lead == 0xED ? 0x9F : 0xBF;
+		}
+		else if (lead < 0xF5)
+		{
+			length = 4;
+			low = lead == 0xF0 ? 0x90 : 0x80;
+			high = lead == 0xF4 ? 0x8F : 0xBF;
+		}
+		else
+			return 0;
+
+		if (length > available || bytes[1] < low || bytes[1] > high)
+			return 0;
+
+		uint32_t value = ((lead & (0x7F >> length)) << 6) | (bytes[1] & 0x3F);
+		for (size_t i = 2; i < length; i++)
+		{
+			if ((bytes[i] & 0xC0) != 0x80)
+				return 0;
+			value = (value << 6) | (bytes[i] & 0x3F);
+		}
+		codepoint = value;
+		return length;
+	}
+
+	// Next code point of a UTF-8 string, malformed bytes decode as U+FFFD one byte at a time
+	inline uint32_t DecodeNext(std::string_view text, size_t& offset)
+	{
+		uint32_t codepoint;
+		size_t length = DecodeSequence(reinterpret_cast<const uint8_t*>(text.data()) + offset, text.size() - offset, codepoint);
+		if (length == 0)
+		{
+			offset++;
+			return ReplacementCharacter;
+		}
+		offset += length;
+		return codepoint;
+	}
+
+	// Appends the encoding of codepoint, surrogates and values past U+10FFFF encode as U+FFFD
+	inline void Encode(uint32_t codepoint, std::string& output)
+	{
+		if ((codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF)
+			codepoint = ReplacementCharacter;
+
+		if (codepoint < 0x80)
+		{
+			output.push_back((char)codepoint);
+		}
+		else if (codepoint < 0x800)
+		{
+			output.push_back((char)(0xC0 | (codepoint >> 6)));
+			output.push_back((char)(0x80 | (codepoint & 0x3F)));
+		}
+		else if (codepoint < 0x10000)
+		{
+			output.push_back((char)(0xE0 | (codepoint >> 12)));
+			output.push_back((char)(0x80 | ((codepoint >> 6) & 0x3F)));
+			output.push_back((char)(0x80 | (codepoint & 0x3F)));
+		}
+		else
+		{
+			output.push_back((char)(0xF0 | (codepoint >> 18)));
+			output.push_back((char)(0x80 | ((codepoint >> 12) & 0x3F)));
+			output.push_back((char)(0x80 | ((codepoint >> 6) & 0x3F)));
+			output.push_back((char)(0x80 | (codepoint & 0x3F)));
+		}
+	}
+
+}
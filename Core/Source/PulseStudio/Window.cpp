@@ -1,7 +1,10 @@
 #include "pspch.h"
 
 #include "Window.h"
+#include "Platform/Headless/HeadlessWindow.h"
+#ifdef PS_PLATFORM_WINDOWS
 #include "Platform/Windows/WindowsWindow.h"
+#endif
 
 #include "Log.h"
 
@@ -9,13 +12,20 @@ namespace PulseStudio {
 
     Window* Window::Create(const WindowProps& props)
     {
+        const char* headless = std::getenv("PS_HEADLESS");
+        bool useHeadless = props.Headless || (headless && std::strcmp(headless, "0") != 0);
+
 #ifdef PS_PLATFORM_WINDOWS
-        LOG_TRACE("Creating window...");
-        return new WindowsWindow(props);
+        if (!useHeadless)
+        {
+            LOG_TRACE("Creating window...");
+            return new WindowsWindow(props);
+        }
 #else
-        PS_CORE_ERROR("Pulse Studio IDE unsupported the platform!");
-        return nullptr;
+        if (!useHeadless)
+            PS_CORE_WARN("No windowing backend on this platform, running headless.");
 #endif
+        return new HeadlessWindow(props);
     }
 
 }
\ No newline at end of file
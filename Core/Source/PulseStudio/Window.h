@@ -11,9 +11,11 @@ namespace PulseStudio {
 	{
 		std::string Title;
 		unsigned int Width, Height;
+		// Use the display-less backend (also selected by PS_HEADLESS=1 and on platforms without a real one)
+		bool Headless;
 
-		WindowProps(const std::string& title = "Pulse Studio", unsigned int width = 1500, unsigned int height = 1000)
-			: Title(title), Width(width), Height(height)
+		WindowProps(const std::string& title = "Pulse Studio", unsigned int width = 1500, unsigned int height = 1000, bool headless = false)
+			: Title(title), Width(width), Height(height), Headless(headless)
 		{
 		}
 	};
@@ -24,7 +26,13 @@ namespace PulseStudio {
 		using EventCallbackFn = std::function<void(Event&)>;
 
 		virtual ~Window() {}
-		virtual void OnUpdate() = 0;
+		// Poll on the main thread, present on the thread that owns the context
+		virtual void PollEvents() = 0;
+		virtual void SwapBuffers() = 0;
+		// Block until an event arrives or the timeout (in seconds) expires
+		virtual void WaitEvents(double timeout) = 0;
+		// Make a pending WaitEvents return early, callable from any thread
+		virtual void WakeUp() = 0;
 		virtual unsigned int GetWidth() const = 0;
 		virtual unsigned int GetHeight() const = 0;
 
@@ -33,6 +41,9 @@ namespace PulseStudio {
 		virtual void SetVSync(bool enabled) = 0;
 		virtual bool IsVSync() const = 0;
 
+		// Bind or release the GL context on the calling thread
+		virtual void SetContextCurrent(bool current) = 0;
+
 		virtual void* GetNativeWindow() const = 0;
 
 		static Window* Create(const WindowProps& props = WindowProps());
@@ -0,0 +1,11 @@
+#!/bin/bash
+
+# Regenerates the list of GL entry points the headless window stubs, run after updating glad
+
+pushd ..
+{
+	echo "// Generated by Scripts/Generate-HeadlessGL.sh from Core/vendor/Glad/include/glad/glad.h, do not edit"
+	echo "// PS_HEADLESS_GL_FUNCTION(name, pointer type)"
+	sed -n -E 's/^GLAPI (PFN[A-Z0-9_]+PROC) glad_([A-Za-z0-9_]+);.*$/PS_HEADLESS_GL_FUNCTION(\2, \1)/p' Core/vendor/Glad/include/glad/glad.h
+} > Core/Source/Platform/Headless/HeadlessGLFunctions.inl
+popd
@@ -0,0 +1,56 @@
+project "Tests"
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++23"
+   targetdir "Binaries/%{cfg.buildcfg}"
+   staticruntime "off"
+
+   files { "Source/**.h", "Source/**.cpp" }
+
+   includedirs
+   {
+      "Source",
+      "../Core/Source",
+      "../Core/vendor/GLFW/include",
+      "../Core/vendor/Glad/include",
+      "../Core/vendor/glm"
+   }
+
+   defines
+   {
+      "GLFW_INCLUDE_NONE"
+   }
+
+   links
+   {
+      "Core"
+   }
+
+   targetdir ("../Binaries/" .. OutputDir .. "/%{prj.name}")
+   objdir ("../Binaries-Intermediates/" .. OutputDir .. "/%{prj.name}")
+
+   filter "system:windows"
+       systemversion "latest"
+       buildoptions { "/utf-8" }
+       defines { "WINDOWS", "PS_PLATFORM_WINDOWS" }
+
+   filter "system:linux"
+       defines { "PS_PLATFORM_LINUX" }
+       links { "Glad", "pthread", "dl" }
+
+   filter "configurations:Debug"
+       defines { "DEBUG" }
+       runtime "Debug"
+       symbols "On"
+
+   filter "configurations:Release"
+       defines { "RELEASE" }
+       runtime "Release"
+       optimize "On"
+       symbols "On"
+
+   filter "configurations:Dist"
+       defines { "DIST" }
+       runtime "Release"
+       optimize "On"
+       symbols "Off"
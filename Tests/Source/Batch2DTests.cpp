@@ -0,0 +1,188 @@
+// Batch2D builds vertices and draw commands on the CPU, so it is tested without a GL context
+
+#include "Test.h"
+
+#include "PulseStudio/Renderer/Batch2D.h"
+
+using namespace PulseStudio;
+
+static TextureRegion Region(uint32_t texture)
+{
+	TextureRegion region;
+	region.TextureID = texture;
+	region.Min = { 0.25f, 0.5f };
+	region.Max = { 0.75f, 1.0f };
+	return region;
+}
+
+static bool SameCommand(const Batch2DCommand& command, uint32_t texture, uint32_t firstQuad, uint32_t quadCount)
+{
+	return command.TextureID == texture && command.FirstQuad == firstQuad && command.QuadCount == quadCount;
+}
+
+PS_TEST(Batch2DMergesConsecutiveQuadsOfOneTexture)
+{
+	Batch2D batch;
+	const glm::vec4 white(1.0f);
+
+	// Untextured shapes of every kind share the white texture and one draw
+	batch.DrawQuad({ 0.0f, 0.0f }, { 10.0f, 10.0f }, white);
+	batch.DrawRoundedRect({ 20.0f, 0.0f }, { 10.0f, 10.0f }, 3.0f, white);
+	batch.DrawLine({ 0.0f, 20.0f }, { 30.0f, 20.0f }, 2.0f, white);
+	batch.DrawQuad({ 0.0f, 30.0f }, { 8.0f, 8.0f }, Region(7));
+	batch.DrawQuad({ 10.0f, 30.0f }, { 8.0f, 8.0f }, Region(7));
+	batch.DrawDistanceField({ 20.0f, 30.0f }, { 8.0f, 8.0f }, Region(7), white);
+
+	const auto& commands = batch.GetCommands();
+	PS_CHECK(commands.size() == 2);
+	PS_CHECK(SameCommand(commands[0], 0, 0, 3));
+	PS_CHECK(SameCommand(commands[1], 7, 3, 3));
+
+	Renderer2DStats stats = batch.GetStats();
+	PS_CHECK(stats.DrawCalls == 2);
+	PS_CHECK(stats.Quads == 6);
+	PS_CHECK(stats.Vertices == 24);
+	PS_CHECK(stats.Indices == 36);
+}
+
+PS_TEST(Batch2DStartsNewDrawOnTextureChange)
+{
+	Batch2D batch;
+
+	// Runs only merge when adjacent, going back to a texture starts another draw to keep the order
+	const uint32_t textures[] = { 1, 1, 2, 1, 3, 3, 3, 0 };
+	for (uint32_t texture : textures)
+		batch.DrawQuad({ 0.0f, 0.0f }, { 4.0f, 4.0f }, Region(texture));
+
+	const auto& commands = batch.GetCommands();
+	PS_CHECK(commands.size() == 5);
+	PS_CHECK(SameCommand(commands[0], 1, 0, 2));
+	PS_CHECK(SameCommand(commands[1], 2, 2, 1));
+	PS_CHECK(SameCommand(commands[2], 1, 3, 1));
+	PS_CHECK(SameCommand(commands[3], 3, 4, 3));
+	PS_CHECK(SameCommand(commands[4], 0, 7, 1));
+
+	// Every quad belongs to exactly one draw, in order
+	uint32_t next = 0;
+	for (const Batch2DCommand& command : commands)
+	{
+		PS_CHECK(command.FirstQuad == next);
+		next += command.QuadCount;
+	}
+	PS_CHECK(next == batch.GetQuadCount());
+}
+
+PS_TEST(Batch2DClearKeepsCapacity)
+{
+	Batch2D batch(4);
+	for (uint32_t i = 0; i < 100; i++)
+		batch.DrawQuad({ 0.0f, 0.0f }, { 1.0f, 1.0f }, Region(i % 3));
+
+	size_t vertexCapacity = batch.GetVertices().capacity();
+	size_t commandCapacity = batch.GetCommands().capacity();
+	batch.Clear();
+
+	PS_CHECK(batch.GetQuadCount() == 0);
+	PS_CHECK(batch.GetCommands().empty());
+	PS_CHECK(batch.GetVertices().capacity() == vertexCapacity);
+	PS_CHECK(batch.GetCommands().capacity() == commandCapacity);
+
+	// The first draw after a clear starts at quad 0 again
+	batch.DrawQuad({ 0.0f, 0.0f }, { 1.0f, 1.0f }, Region(2));
+	PS_CHECK(batch.GetCommands().size() == 1);
+	PS_CHECK(SameCommand(batch.GetCommands()[0], 2, 0, 1));
+}
+
+PS_TEST(Batch2DTexturedQuadCorners)
+{
+	Batch2D batch;
+	batch.DrawQuad({ 10.0f, 20.0f }, { 30.0f, 40.0f }, Region(4), glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+
+	// Top left, top right, bottom right, bottom left
+	const auto& v = batch.GetVertices();
+	PS_CHECK(v.size() == 4);
+	PS_CHECK(v[0].Position == glm::vec2(10.0f, 20.0f) && v[0].TexCoord == glm::vec2(0.25f, 0.5f));
+	PS_CHECK(v[1].Position == glm::vec2(40.0f, 20.0f) && v[1].TexCoord == glm::vec2(0.75f, 0.5f));
+	PS_CHECK(v[2].Position == glm::vec2(40.0f, 60.0f) && v[2].TexCoord == glm::vec2(0.75f, 1.0f));
+	PS_CHECK(v[3].Position == glm::vec2(10.0f, 60.0f) && v[3].TexCoord == glm::vec2(0.25f, 1.0f));
+
+	// A plain quad has no shape, radius 0 skips the rounded box in the shader
+	for (const Batch2DVertex& vertex : v)
+	{
+		PS_CHECK(vertex.Color == 0xFF0000FFu);
+		PS_CHECK(vertex.Shape == glm::vec3(0.0f));
+	}
+}
+
+PS_TEST(Batch2DRoundedRectShape)
+{
+	Batch2D batch;
+	batch.DrawRoundedRect({ 100.0f, 50.0f }, { 40.0f, 20.0f }, 6.0f, glm::vec4(1.0f));
+
+	// Local positions are relative to the center and span the half size
+	const auto& v = batch.GetVertices();
+	PS_CHECK(v.size() == 4);
+	PS_CHECK(v[0].Local == glm::vec2(-20.0f, -10.0f));
+	PS_CHECK(v[1].Local == glm::vec2(20.0f, -10.0f));
+	PS_CHECK(v[2].Local == glm::vec2(20.0f, 10.0f));
+	PS_CHECK(v[3].Local == glm::vec2(-20.0f, 10.0f));
+	for (const Batch2DVertex& vertex : v)
+		PS_CHECK(vertex.Shape == glm::vec3(20.0f, 10.0f, 6.0f));
+
+	// The radius is clamped to half the shorter side, negative radii and sizes draw a plain quad
+	batch.Clear();
+	batch.DrawRoundedRect({ 0.0f, 0.0f }, { 40.0f, 20.0f }, 50.0f, glm::vec4(1.0f));
+	batch.DrawRoundedRect({ 0.0f, 0.0f }, { 40.0f, 20.0f }, -3.0f, glm::vec4(1.0f));
+	batch.DrawRoundedRect({ 0.0f, 0.0f }, { -40.0f, 20.0f }, 6.0f, glm::vec4(1.0f));
+	PS_CHECK(batch.GetVertices()[0].Shape.z == 10.0f);
+	PS_CHECK(batch.GetVertices()[4].Shape.z == 0.0f);
+	PS_CHECK(batch.GetVertices()[8].Shape.z == 0.0f);
+}
+
+PS_TEST(Batch2DDistanceFieldMarksShape)
+{
+	Batch2D batch;
+	batch.DrawDistanceField({ 0.0f, 0.0f }, { 16.0f, 32.0f }, Region(9), glm::vec4(1.0f));
+
+	// A negative radius tells the shader to read the texture alpha as a distance field
+	for (const Batch2DVertex& vertex : batch.GetVertices())
+	{
+		PS_CHECK(vertex.Shape.z < 0.0f);
+		PS_CHECK(glm::vec2(vertex.Shape) == glm::vec2(8.0f, 16.0f));
+	}
+	PS_CHECK(SameCommand(batch.GetCommands()[0], 9, 0, 1));
+}
+
+PS_TEST(Batch2DLineExtrusion)
+{
+	Batch2D batch;
+	batch.DrawLine({ 0.0f, 0.0f }, { 10.0f, 0.0f }, 2.0f, glm::vec4(1.0f));
+
+	// Half the thickness to either side of the segment
+	const auto& v = batch.GetVertices();
+	PS_CHECK(v.size() == 4);
+	PS_CHECK(v[0].Position == glm::vec2(0.0f, 1.0f));
+	PS_CHECK(v[1].Position == glm::vec2(10.0f, 1.0f));
+	PS_CHECK(v[2].Position == glm::vec2(10.0f, -1.0f));
+	PS_CHECK(v[3].Position == glm::vec2(0.0f, -1.0f));
+
+	// Diagonal lines keep their thickness
+	batch.Clear();
+	batch.DrawLine({ 0.0f, 0.0f }, { 3.0f, 4.0f }, 4.0f, glm::vec4(1.0f));
+	PS_CHECK(Test::Near(glm::length(batch.GetVertices()[0].Position - batch.GetVertices()[3].Position), 4.0f));
+	PS_CHECK(Test::Near(glm::length(batch.GetVertices()[1].Position - batch.GetVertices()[0].Position), 5.0f));
+
+	// A zero-length line draws nothing
+	batch.Clear();
+	batch.DrawLine({ 5.0f, 5.0f }, { 5.0f, 5.0f }, 2.0f, glm::vec4(1.0f));
+	PS_CHECK(batch.GetQuadCount() == 0);
+	PS_CHECK(batch.GetCommands().empty());
+}
+
+PS_TEST(Batch2DPackColor)
+{
+	PS_CHECK(Batch2D::PackColor(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f)) == 0xFF0000FFu);
+	PS_CHECK(Batch2D::PackColor(glm::vec4(0.0f, 0.0f, 1.0f, 0.5f)) == 0x80FF0000u);
+	// Out of range channels are clamped
+	PS_CHECK(Batch2D::PackColor(glm::vec4(2.0f, -1.0f, 0.0f, 1.0f)) == 0xFF0000FFu);
+}
@@ -0,0 +1,54 @@
+// The render thread runs on a headless window, whose GL entry points are no-ops
+
+#include "Test.h"
+
+#include "PulseStudio/Renderer/RenderThread.h"
+#include "PulseStudio/Window.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace PulseStudio;
+
+// The render thread executes frames asynchronously, give it a generous deadline
+static bool WaitFor(const std::atomic<int>& value, int expected)
+{
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (value.load() < expected)
+	{
+		if (std::chrono::steady_clock::now() > deadline)
+			return false;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return value.load() == expected;
+}
+
+PS_TEST(RenderThreadResizeRepaintSkipsOnceWork)
+{
+	std::unique_ptr<Window> window(Window::Create(WindowProps("Tests", 640, 480, true)));
+	RenderThread renderThread;
+	renderThread.Start(window.get(), RenderThreadMode::Threaded);
+
+	std::atomic<int> once = 0, frame = 0, repaints = 0;
+	renderThread.SubmitOnce([&]() { once++; });
+	renderThread.Submit([&]()
+	{
+		repaints += renderThread.IsRepainting();
+		frame++;
+	});
+	renderThread.EndFrame();
+	PS_CHECK(WaitFor(frame, 1));
+
+	PS_CHECK(repaints.load() == 0);
+
+	// Every resize repaints the last frame without creating its resources again
+	renderThread.NotifyResize(800, 600);
+	PS_CHECK(WaitFor(frame, 2));
+	renderThread.NotifyResize(1024, 768);
+	PS_CHECK(WaitFor(frame, 3));
+
+	renderThread.Stop();
+	PS_CHECK(once.load() == 1);
+	PS_CHECK(repaints.load() == 2);
+}
@@ -0,0 +1,94 @@
+#include "Test.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace Test {
+
+	struct Entry
+	{
+		const char* Name;
+		Function Run;
+	};
+
+	// Function-local so registration from other translation units never sees it uninitialized
+	static std::vector<Entry>& GetRegistry()
+	{
+		static std::vector<Entry> s_Registry;
+		return s_Registry;
+	}
+
+	static int s_Failures = 0;
+
+	bool Register(const char* name, Function function)
+	{
+		GetRegistry().push_back({ name, function });
+		return true;
+	}
+
+	void ReportFailure(const char* file, int line, const char* expression)
+	{
+		std::printf("  %s(%d): check failed: %s\n", file, line, expression);
+		s_Failures++;
+	}
+
+}
+
+int main(int argc, char** argv)
+{
+	bool list = false;
+	std::vector<std::string_view> filters;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg = argv[i];
+		if (arg == "--list")
+			list = true;
+		else
+			filters.push_back(arg);
+	}
+
+	auto& registry = Test::GetRegistry();
+	std::sort(registry.begin(), registry.end(), [](const auto& a, const auto& b) { return std::strcmp(a.Name, b.Name) < 0; });
+
+	int ran = 0, failed = 0;
+	for (const auto& entry : registry)
+	{
+		std::string_view name = entry.Name;
+		bool selected = filters.empty() || std::any_of(filters.begin(), filters.end(),
+			[&](std::string_view filter) { return name.find(filter) != std::string_view::npos; });
+		if (!selected)
+			continue;
+
+		if (list)
+		{
+			std::printf("%s\n", entry.Name);
+			continue;
+		}
+
+		int failuresBefore = Test::s_Failures;
+		entry.Run();
+		bool passed = Test::s_Failures == failuresBefore;
+		std::printf("[%s] %s\n", passed ? "  OK  " : "FAILED", entry.Name);
+		std::fflush(stdout);
+
+		ran++;
+		if (!passed)
+			failed++;
+	}
+
+	if (list)
+		return 0;
+
+	if (ran == 0)
+	{
+		std::fprintf(stderr, "No test matches the filter\n");
+		return 1;
+	}
+
+	std::printf("%d of %d tests passed\n", ran - failed, ran);
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+// Minimal test harness. A test registers itself with PS_TEST and checks with PS_CHECK, a failed
+// check is reported and the test carries on; the runner exits non-zero if any check failed.
+//
+// Usage: Tests [--list] [name filter...]
+
+#include <cmath>
+
+namespace Test {
+
+	using Function = void(*)();
+
+	bool Register(const char* name, Function function);
+
+	void ReportFailure(const char* file, int line, const char* expression);
+
+	inline bool Near(float a, float b, float tolerance = 1e-4f) { return std::fabs(a - b) <= tolerance; }
+
+}
+
+#define PS_TEST(name) \
+	static void name(); \
+	static const bool s_##name##Registered = Test::Register(#name, name); \
+	static void name()
+
+#define PS_CHECK(expression) \
+	do { if (!(expression)) Test::ReportFailure(__FILE__, __LINE__, #expression); } while (0)
@@ -0,0 +1,224 @@
+// Every Utf8 kernel the CPU supports must give the scalar kernel's results, which in turn must match
+// DecodeSequence() walked one code point at a time
+
+#include "Test.h"
+
+#include "PulseStudio/Text/Utf8.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace PulseStudio;
+
+namespace {
+
+	struct Results
+	{
+		size_t Valid = 0;
+		size_t Codepoints = 0;
+		std::vector<uint32_t> Decoded;
+		std::vector<uint32_t> DecodedShort;	// Output half the size of the text
+		std::vector<size_t> Newlines;		// See FindNewlines()
+		size_t NewlineCount = 0;
+
+		bool operator==(const Results&) const = default;
+	};
+
+	// Malformed on their own, the bytes around them can still complete a cut sequence
+	const std::vector<std::string> s_Malformed = {
+		"\xC0\xAF", "\xC1\xBF", "\xE0\x80\xAF", "\xE0\x9F\xBF", "\xF0\x80\x80\xAF", "\xF0\x8F\xBF\xBF",	// Overlong
+		"\xED\xA0\x80", "\xED\xAF\xBF", "\xED\xB0\x80", "\xED\xBF\xBF",									// Surrogates
+		"\xF4\x90\x80\x80", "\xF4\xBF\xBF\xBF", "\xF5\x80\x80\x80", "\xF7\xBF\xBF\xBF", "\xFF",			// Past U+10FFFF
+		"\x80", "\xBF", "\xC2", "\xE2\x82", "\xF0\x9F\x98", "\xE2\x28\xA1", "\xF0\x9F\x28\x80"			// Stray or cut short
+	};
+
+}
+
+// FindNewline from every offset of the first two vector widths, then from line to line
+template<typename Find>
+static std::vector<size_t> FindNewlines(const std::string& text, Find&& find)
+{
+	std::vector<size_t> newlines;
+	for (size_t offset = 0; offset < std::min<size_t>(text.size(), 130); offset++)
+		newlines.push_back(find(offset));
+	for (size_t offset = 0; offset < text.size(); offset = newlines.back() + 1)
+		newlines.push_back(find(offset));
+	return newlines;
+}
+
+static Results Run(const std::string& text)
+{
+	Results results;
+	results.Valid = Utf8::Validate(text);
+	results.Codepoints = Utf8::CountCodepoints(text);
+
+	results.Decoded.resize(text.size());
+	results.Decoded.resize(Utf8::Decode(text, results.Decoded));
+	results.DecodedShort.resize(text.size() / 2);
+	results.DecodedShort.resize(Utf8::Decode(text, results.DecodedShort));
+
+	results.Newlines = FindNewlines(text, [&](size_t offset) { return Utf8::FindNewline(text, offset); });
+	results.NewlineCount = Utf8::CountNewlines(text);
+	return results;
+}
+
+// Validate and Decode spelled out with DecodeSequence
+static Results RunReference(const std::string& text)
+{
+	Results results;
+	results.Valid = text.size();
+	const uint8_t* bytes = reinterpret_cast<const uint8_t*>(text.data());
+	for (size_t offset = 0; offset < text.size(); )
+	{
+		uint32_t codepoint;
+		size_t length = Utf8::DecodeSequence(bytes + offset, text.size() - offset, codepoint);
+		if (length == 0)
+		{
+			results.Valid = std::min(results.Valid, offset);
+			codepoint = Utf8::ReplacementCharacter;
+			length = 1;
+		}
+		results.Decoded.push_back(codepoint);
+		offset += length;
+	}
+	results.DecodedShort.assign(results.Decoded.begin(), results.Decoded.begin() + std::min(results.Decoded.size(), text.size() / 2));
+
+	for (size_t offset = 0; offset < text.size(); offset++)
+	{
+		results.Codepoints += (bytes[offset] & 0xC0) != 0x80;
+		results.NewlineCount += bytes[offset] == '\n';
+	}
+	results.Newlines = FindNewlines(text, [&](size_t offset)
+		{
+			size_t newline = text.find('\n', offset);
+			return newline == std::string::npos ? text.size() : newline;
+		});
+	return results;
+}
+
+// Well-formed text mixing ASCII, line breaks and two, three (CJK) and four byte sequences, with
+// runs of one kind so the vector kernels take their fast paths as well
+static std::string MakeValidText(std::mt19937& random, size_t size)
+{
+	std::string text;
+	while (text.size() < size)
+	{
+		uint32_t kind = random() % 6;
+		uint32_t run = 1 + random() % 40;
+		for (uint32_t i = 0; i < run; i++)
+		{
+			switch (kind)
+			{
+				case 0: text += (char)(0x20 + random() % 0x5F); break;
+				case 1: text += random() % 4 == 0 ? '\n' : (char)(random() % 0x80); break;
+				case 2: Utf8::Encode(0x80 + random() % (0x800 - 0x80), text); break;
+				case 3: Utf8::Encode(0x4E00 + random() % (0xA000 - 0x4E00), text); break;
+				case 4:
+				{
+					// Every three byte value outside the surrogates
+					uint32_t codepoint = 0x800 + random() % (0x10000 - 0x800 - 0x800);
+					Utf8::Encode(codepoint < 0xD800 ? codepoint : codepoint + 0x800, text);
+					break;
+				}
+				case 5: Utf8::Encode(0x10000 + random() % (0x110000 - 0x10000), text); break;
+			}
+		}
+	}
+	return text;
+}
+
+// Overwrites bytes with a malformed sequence, placed across a 64 byte chunk edge every other time
+static void InsertMalformed(std::mt19937& random, std::string& text)
+{
+	const std::string& sequence = s_Malformed[random() % s_Malformed.size()];
+	if (text.size() < sequence.size() + 1)
+		return;
+
+	size_t offset = random() % (text.size() - sequence.size() + 1);
+	if (random() % 2 == 0 && text.size() > 64)
+	{
+		size_t edge = 64 * (1 + random() % (text.size() / 64));
+		size_t before = 1 + random() % sequence.size();
+		if (edge >= before && edge - before + sequence.size() <= text.size())
+			offset = edge - before;
+	}
+	text.replace(offset, sequence.size(), sequence);
+}
+
+static std::vector<std::string> MakeInputs()
+{
+	std::mt19937 random(20261017);
+	std::vector<std::string> inputs;
+
+	// Every malformed sequence at every position around the first chunk edge, in ASCII and CJK
+	for (const std::string& sequence : s_Malformed)
+	{
+		for (size_t offset = 64 - sequence.size() - 2; offset <= 66; offset++)
+		{
+			std::string ascii(160, 'a');
+			ascii.replace(offset, sequence.size(), sequence);
+			inputs.push_back(ascii);
+
+			std::string cjk;
+			while (cjk.size() < 160)
+				Utf8::Encode(0x4E2D, cjk);
+			cjk.replace(offset, sequence.size(), sequence);
+			inputs.push_back(cjk);
+		}
+	}
+
+	// Random lengths, so the tails after the last full vector are covered too
+	for (uint32_t i = 0; i < 3000; i++)
+	{
+		size_t size = i < 2000 ? random() % 300 : 300 + random() % 4000;
+		std::string text = MakeValidText(random, size);
+		if (i % 3 != 0)
+		{
+			uint32_t errors = 1 + random() % 4;
+			for (uint32_t error = 0; error < errors; error++)
+				InsertMalformed(random, text);
+		}
+		inputs.push_back(std::move(text));
+	}
+	return inputs;
+}
+
+PS_TEST(Utf8KernelsMatchTheScalarKernel)
+{
+	std::vector<std::string> inputs = MakeInputs();
+	Utf8::Kernel original = Utf8::GetKernel();
+
+	Utf8::SetKernel(Utf8::Kernel::Scalar);
+	std::vector<Results> expected;
+	bool sawValid = false, sawInvalid = false;
+	for (const std::string& text : inputs)
+	{
+		expected.push_back(Run(text));
+		PS_CHECK(expected.back() == RunReference(text));
+
+		bool valid = expected.back().Valid == text.size();
+		sawValid |= valid;
+		sawInvalid |= !valid;
+	}
+	PS_CHECK(sawValid && sawInvalid);
+
+	for (Utf8::Kernel kernel : { Utf8::Kernel::SSE41, Utf8::Kernel::AVX2 })
+	{
+		Utf8::SetKernel(kernel);
+		if (Utf8::GetKernel() != kernel)
+		{
+			std::printf("  %s not supported by this CPU, not tested\n", Utf8::GetKernelName(kernel));
+			continue;
+		}
+
+		size_t mismatches = 0;
+		for (size_t i = 0; i < inputs.size(); i++)
+			mismatches += !(Run(inputs[i]) == expected[i]);
+		PS_CHECK(mismatches == 0);
+	}
+
+	Utf8::SetKernel(original);
+}
@@ -0,0 +1,266 @@
+// LogDecode - turns a Pulse Studio binary log back into the text log format
+//
+// Usage: LogDecode <input.pslog> [output.log]
+
+#include "PulseStudio/BinaryLogFormat.h"
+
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <format>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct DecodedArg
+{
+	BinaryLog::ArgType Type = BinaryLog::ArgType::Int;
+	int64_t Int = 0;
+	uint64_t UInt = 0;
+	double Double = 0.0;
+	std::string String;
+};
+
+static const char* LevelToString(uint8_t level)
+{
+	static const char* s_Names[] = { "Debug", "Trace", "Info", "Warn", "Error", "Fatal" };
+	return level < std::size(s_Names) ? s_Names[level] : "Unknown";
+}
+
+static std::string FormatTimestamp(int64_t tick, uint64_t ticksPerSecond)
+{
+	int64_t seconds = tick / (int64_t)ticksPerSecond;
+	int64_t ms = (tick % (int64_t)ticksPerSecond) * 1000 / (int64_t)ticksPerSecond;
+
+	// A corrupt tick delta can put the time out of the calendar's range
+	std::time_t time = (std::time_t)seconds;
+	std::tm local{};
+#ifdef _WIN32
+	bool converted = localtime_s(&local, &time) == 0;
+#else
+	bool converted = localtime_r(&time, &local) != nullptr;
+#endif
+	if (!converted)
+		return "<bad time " + std::to_string(tick) + ">";
+
+	std::stringstream ss;
+	ss << std::put_time(&local, "%Y/%m/%d %H:%M:%S")
+		<< '.' << std::setfill('0') << std::setw(3) << ms;
+	return ss.str();
+}
+
+static bool ReadArg(BinaryLog::Reader& reader, DecodedArg& arg)
+{
+	using BinaryLog::ArgType;
+
+	uint8_t type;
+	if (!reader.ReadByte(type))
+		return false;
+
+	arg.Type = (ArgType)type;
+	switch (arg.Type)
+	{
+	case ArgType::Bool:
+	case ArgType::Char:
+	{
+		uint8_t value;
+		if (!reader.ReadByte(value))
+			return false;
+		arg.UInt = value;
+		return true;
+	}
+	case ArgType::Int:     return reader.ReadZigzag(arg.Int);
+	case ArgType::UInt:
+	case ArgType::Pointer: return reader.ReadVarint(arg.UInt);
+	case ArgType::Double:  return reader.ReadRaw(&arg.Double, sizeof(arg.Double));
+	case ArgType::String:  return reader.ReadString(arg.String);
+	}
+	return false;
+}
+
+// Format a single argument with the replacement field spec it was logged with
+static std::string FormatArg(const DecodedArg& arg, std::string_view spec)
+{
+	using BinaryLog::ArgType;
+
+	std::string field = spec.empty() ? "{}" : "{:" + std::string(spec) + "}";
+	try
+	{
+		switch (arg.Type)
+		{
+		case ArgType::Bool:    { bool value = arg.UInt != 0; return std::vformat(field, std::make_format_args(value)); }
+		case ArgType::Char:    { char value = (char)arg.UInt; return std::vformat(field, std::make_format_args(value)); }
+		case ArgType::Int:     { int64_t value = arg.Int; return std::vformat(field, std::make_format_args(value)); }
+		case ArgType::UInt:    { uint64_t value = arg.UInt; return std::vformat(field, std::make_format_args(value)); }
+		case ArgType::Double:  { double value = arg.Double; return std::vformat(field, std::make_format_args(value)); }
+		case ArgType::String:  { const std::string& value = arg.String; return std::vformat(field, std::make_format_args(value)); }
+		case ArgType::Pointer: { const void* value = (const void*)(uintptr_t)arg.UInt; return std::vformat(field, std::make_format_args(value)); }
+		}
+	}
+	catch (const std::format_error&)
+	{
+	}
+
+	return "<bad arg>";
+}
+
+// Re-apply a std::format string to decoded arguments, one replacement field at a time
+static std::string FormatMessage(std::string_view format, const std::vector<DecodedArg>& args)
+{
+	std::string out;
+	size_t nextIndex = 0;
+
+	for (size_t i = 0; i < format.size(); ++i)
+	{
+		char c = format[i];
+		if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c)
+		{
+			out += c;
+			++i;
+			continue;
+		}
+
+		if (c != '{')
+		{
+			out += c;
+			continue;
+		}
+
+		size_t end = format.find('}', i);
+		if (end == std::string_view::npos)
+		{
+			out.append(format.substr(i));
+			break;
+		}
+
+		std::string_view field = format.substr(i + 1, end - i - 1);
+		std::string_view index = field.substr(0, field.find(':'));
+		std::string_view spec = index.size() < field.size() ? field.substr(index.size() + 1) : std::string_view();
+
+		size_t argIndex = nextIndex++;
+		if (!index.empty())
+		{
+			// The format string comes from the file, a corrupt index must not end the decode
+			auto [last, error] = std::from_chars(index.data(), index.data() + index.size(), argIndex);
+			if (error != std::errc() || last != index.data() + index.size())
+			{
+				out += "<bad arg>";
+				i = end;
+				continue;
+			}
+		}
+
+		out += argIndex < args.size() ? FormatArg(args[argIndex], spec) : "<missing arg>";
+		i = end;
+	}
+
+	return out;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cerr << "Usage: LogDecode <input.pslog> [output.log]" << std::endl;
+		return 1;
+	}
+
+	std::ifstream input(argv[1], std::ios::in | std::ios::binary);
+	if (!input.is_open())
+	{
+		std::cerr << "Failed to open binary log: " << argv[1] << std::endl;
+		return 1;
+	}
+	std::string data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+	std::ofstream outputFile;
+	if (argc >= 3)
+	{
+		outputFile.open(argv[2], std::ios::out | std::ios::trunc);
+		if (!outputFile.is_open())
+		{
+			std::cerr << "Failed to open output file: " << argv[2] << std::endl;
+			return 1;
+		}
+	}
+	std::ostream& output = outputFile.is_open() ? outputFile : std::cout;
+
+	BinaryLog::Reader reader(data.data(), data.size());
+	std::unordered_map<uint64_t, std::string> formats;
+	std::vector<DecodedArg> args;
+	uint64_t ticksPerSecond = 0;
+	int64_t tick = 0;
+	size_t entries = 0;
+
+	while (!reader.AtEnd())
+	{
+		// Every session starts with its own header and format table
+		if (data.compare(reader.GetOffset(), sizeof(BinaryLog::s_Magic), BinaryLog::s_Magic, sizeof(BinaryLog::s_Magic)) == 0)
+		{
+			if (!reader.ReadHeader(ticksPerSecond) || ticksPerSecond == 0)
+			{
+				std::cerr << "Unsupported binary log header at offset " << reader.GetOffset() << std::endl;
+				return 1;
+			}
+			formats.clear();
+			formats[BinaryLog::s_MessageFormatId] = std::string(BinaryLog::s_MessageFormat);
+			tick = 0;
+			continue;
+		}
+
+		if (ticksPerSecond == 0)
+		{
+			std::cerr << "Missing binary log header" << std::endl;
+			return 1;
+		}
+
+		uint8_t kind;
+		reader.ReadByte(kind);
+
+		bool ok = false;
+		if (kind == (uint8_t)BinaryLog::RecordKind::FormatDef)
+		{
+			uint64_t id;
+			std::string format;
+			ok = reader.ReadVarint(id) && reader.ReadString(format);
+			if (ok)
+				formats[id] = std::move(format);
+		}
+		else if (kind == (uint8_t)BinaryLog::RecordKind::Entry)
+		{
+			uint8_t level = 0, argCount = 0;
+			uint64_t formatId = 0, threadId = 0;
+			int64_t tickDelta = 0;
+			ok = reader.ReadByte(level) && reader.ReadVarint(formatId) && reader.ReadZigzag(tickDelta)
+				&& reader.ReadVarint(threadId) && reader.ReadByte(argCount);
+
+			args.resize(argCount);
+			for (uint8_t i = 0; ok && i < argCount; ++i)
+				ok = ReadArg(reader, args[i]);
+
+			if (ok)
+			{
+				tick += tickDelta;
+				auto it = formats.find(formatId);
+				std::string message = it != formats.end() ? FormatMessage(it->second, args) : "<unknown format " + std::to_string(formatId) + ">";
+				output << "[" << FormatTimestamp(tick, ticksPerSecond) << "][" << LevelToString(level) << "] -> " << message << '\n';
+				++entries;
+			}
+		}
+
+		if (!ok)
+		{
+			std::cerr << "Truncated or corrupt record at offset " << reader.GetOffset() << ", stopping." << std::endl;
+			break;
+		}
+	}
+
+	std::cerr << "Decoded " << entries << " log entries." << std::endl;
+	return 0;
+}